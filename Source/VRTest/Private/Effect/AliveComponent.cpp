@@ -27,23 +27,29 @@ void UAliveComponent::DecreaseHP(float DecreaseAmount)
 {
 	if (HP <= 0.0f) return;
 
+	const float OldHP = HP;
 	HP -= DecreaseAmount;
 	if (HP <= 0.0f)
 	{
 		HP = 0.0f;
+		NotifyHPChanged(OldHP);
 		OnDead.Broadcast();
+		return;
 	}
+	NotifyHPChanged(OldHP);
 }
 
 void UAliveComponent::IncreaseHP(float IncreaseAmount)
 {
 	if (HP <= 0.0f) return; // Usually dead characters don't recover HP automatically, logic can be adjusted if needed
 
+	const float OldHP = HP;
 	HP += IncreaseAmount;
 	if (HP > MaxHP)
 	{
 		HP = MaxHP;
 	}
+	NotifyHPChanged(OldHP);
 }
 
 bool UAliveComponent::SetHP(float TargetHP)
@@ -52,10 +58,41 @@ bool UAliveComponent::SetHP(float TargetHP)
 	{
 		return false;
 	}
+	const float OldHP = HP;
 	HP = TargetHP;
+	NotifyHPChanged(OldHP);
 	if (HP <= 0.0f)
 	{
 		OnDead.Broadcast();
 	}
 	return true;
 }
+
+void UAliveComponent::BeginHPBatch()
+{
+	if (HPBatchDepth++ == 0)
+	{
+		HPBeforeBatch = HP;
+	}
+}
+
+void UAliveComponent::EndHPBatch()
+{
+	if (HPBatchDepth <= 0)
+	{
+		return;
+	}
+
+	if (--HPBatchDepth == 0 && HP != HPBeforeBatch)
+	{
+		OnHPChanged.Broadcast(HP, HP - HPBeforeBatch);
+	}
+}
+
+void UAliveComponent::NotifyHPChanged(float OldHP)
+{
+	if (HPBatchDepth == 0 && HP != OldHP)
+	{
+		OnHPChanged.Broadcast(HP, HP - OldHP);
+	}
+}
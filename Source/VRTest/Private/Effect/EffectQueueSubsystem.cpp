@@ -0,0 +1,162 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Effect/EffectQueueSubsystem.h"
+#include "Effect/Effectable.h"
+#include "Effect/AliveComponent.h"
+#include "Game/Characters/BaseCharacter.h"
+#include "Game/GameSettings.h"
+#include "Game/VRTestStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UEffectQueueSubsystem* UEffectQueueSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UEffectQueueSubsystem>() : nullptr;
+}
+
+void UEffectQueueSubsystem::ApplyEffect(AActor* Target, const FEffect& Effect)
+{
+	if (!IsValid(Target) || !Target->Implements<UEffectable>())
+	{
+		return;
+	}
+
+	const UGameSettings* Settings = UGameSettings::Get();
+	const bool bQueue = (!Settings || Settings->bQueueCharacterEffects) && Target->IsA<ABaseCharacter>();
+	UEffectQueueSubsystem* Queue = bQueue ? Get(Target) : nullptr;
+	if (Queue)
+	{
+		Queue->Enqueue(Target, Effect);
+		return;
+	}
+
+	IEffectable::Execute_ApplyEffect(Target, Effect);
+}
+
+bool UEffectQueueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UEffectQueueSubsystem::Deinitialize()
+{
+	Records.Reset();
+	RecordIndex.Reset();
+	ResolvingRecords.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UEffectQueueSubsystem::IsTickable() const
+{
+	// 队列为空时不 Tick
+	return Records.Num() > 0;
+}
+
+TStatId UEffectQueueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEffectQueueSubsystem, STATGROUP_Tickables);
+}
+
+void UEffectQueueSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	Flush();
+}
+
+void UEffectQueueSubsystem::Enqueue(AActor* Target, const FEffect& Effect)
+{
+	if (!IsValid(Target))
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_VRTest_EffectsQueued);
+
+	const uint8 TypeMask = MakeEffectTypeMask(Effect.EffectTypes);
+	const TPair<FObjectKey, uint8> Key(FObjectKey(Target), TypeMask);
+
+	FEffectRecord* Record;
+	if (const int32* Found = RecordIndex.Find(Key))
+	{
+		Record = &Records[*Found];
+	}
+	else
+	{
+		RecordIndex.Add(Key, Records.Num());
+		Record = &Records.AddDefaulted_GetRef();
+		Record->Target = Target;
+		Record->TypeMask = TypeMask;
+	}
+
+	Record->Amount += Effect.Amount;
+	Record->Duration = FMath::Max(Record->Duration, Effect.Duration);
+	Record->Causer = Effect.Causer;
+	Record->Instigator = Effect.Instigator;
+	++Record->HitCount;
+}
+
+void UEffectQueueSubsystem::Flush()
+{
+	if (Records.Num() == 0 || bFlushing)
+	{
+		return;
+	}
+
+	TGuardValue<bool> FlushingGuard(bFlushing, true);
+	SCOPE_CYCLE_COUNTER(STAT_VRTest_EffectResolve);
+
+	// 结算中（例如死亡回调）提交的效果进入新队列，下一次再结算
+	ResolvingRecords.Reset();
+	Swap(ResolvingRecords, Records);
+	RecordIndex.Reset();
+
+	// 同一目标的 HP 变化合并：首次遇到时开始批量，全部结算完再统一结束
+	TArray<TWeakObjectPtr<UAliveComponent>, TInlineAllocator<16>> BatchedAliveComponents;
+
+	for (const FEffectRecord& Record : ResolvingRecords)
+	{
+		AActor* Target = Record.Target.Get();
+		if (!IsValid(Target))
+		{
+			continue;
+		}
+
+		if (const ABaseCharacter* Character = Cast<ABaseCharacter>(Target))
+		{
+			UAliveComponent* AliveComponent = Character->AliveComponent;
+			if (AliveComponent && !BatchedAliveComponents.Contains(AliveComponent))
+			{
+				AliveComponent->BeginHPBatch();
+				BatchedAliveComponents.Add(AliveComponent);
+			}
+		}
+
+		FEffect Effect;
+		EffectTypeMaskToArray(Record.TypeMask, Effect.EffectTypes);
+		Effect.Amount = Record.Amount;
+		Effect.Duration = Record.Duration;
+		Effect.Causer = Record.Causer.Get();
+		Effect.Instigator = Record.Instigator.Get();
+
+		IEffectable::Execute_ApplyEffect(Target, Effect);
+		INC_DWORD_STAT(STAT_VRTest_EffectsResolved);
+	}
+
+	for (const TWeakObjectPtr<UAliveComponent>& AliveComponent : BatchedAliveComponents)
+	{
+		if (AliveComponent.IsValid())
+		{
+			AliveComponent->EndHPBatch();
+		}
+	}
+
+	ResolvingRecords.Reset();
+}
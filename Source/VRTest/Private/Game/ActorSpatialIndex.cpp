@@ -0,0 +1,181 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/ActorSpatialIndex.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+
+FActorSpatialIndex::FActorSpatialIndex(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+	, InvCellSize(1.0f / FMath::Max(InCellSize, 1.0f))
+{
+}
+
+int32 FActorSpatialIndex::Add(AActor* Actor, const UPrimitiveComponent* BoundsComponent, float FallbackRadius)
+{
+	if (!Actor)
+	{
+		return INDEX_NONE;
+	}
+
+	if (const int32* Existing = IndexByActor.Find(FObjectKey(Actor)))
+	{
+		BoundsComponents[*Existing] = BoundsComponent;
+		return *Existing;
+	}
+
+	const int32 Index = Actors.Add(Actor);
+	EntryKeys.Add(FObjectKey(Actor));
+	BoundsComponents.Add(BoundsComponent);
+	Positions.Add(BoundsComponent ? BoundsComponent->Bounds.Origin : Actor->GetActorLocation());
+	Radii.Add(BoundsComponent ? BoundsComponent->Bounds.SphereRadius : FallbackRadius);
+	EntryCells.Add(FIntVector::ZeroValue);
+	EntryOversize.Add(false);
+	IndexByActor.Add(FObjectKey(Actor), Index);
+
+	Bin(Index);
+	return Index;
+}
+
+bool FActorSpatialIndex::Remove(const AActor* Actor)
+{
+	const int32* Found = Actor ? IndexByActor.Find(FObjectKey(Actor)) : nullptr;
+	if (!Found)
+	{
+		return false;
+	}
+
+	RemoveAt(*Found);
+	return true;
+}
+
+void FActorSpatialIndex::Reset()
+{
+	Positions.Reset();
+	Radii.Reset();
+	Actors.Reset();
+	EntryKeys.Reset();
+	BoundsComponents.Reset();
+	EntryCells.Reset();
+	EntryOversize.Reset();
+	IndexByActor.Reset();
+	Cells.Reset();
+	OversizeEntries.Reset();
+}
+
+void FActorSpatialIndex::Refresh()
+{
+	for (int32 Index = Actors.Num() - 1; Index >= 0; --Index)
+	{
+		const AActor* Actor = Actors[Index].Get();
+		if (!Actor)
+		{
+			RemoveAt(Index);
+			continue;
+		}
+
+		// Primitive 的 Bounds 在组件移动时已由引擎更新，这里只是读缓存
+		if (const UPrimitiveComponent* BoundsComponent = BoundsComponents[Index].Get())
+		{
+			Positions[Index] = BoundsComponent->Bounds.Origin;
+			Radii[Index] = BoundsComponent->Bounds.SphereRadius;
+		}
+		else
+		{
+			Positions[Index] = Actor->GetActorLocation();
+		}
+
+		const bool bOversize = IsOversize(Radii[Index]);
+		if (bOversize != EntryOversize[Index] || (!bOversize && GetCellCoord(Positions[Index]) != EntryCells[Index]))
+		{
+			Unbin(Index);
+			Bin(Index);
+		}
+	}
+}
+
+// ==================== 内部函数 ====================
+
+FIntVector FActorSpatialIndex::GetCellCoord(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X * InvCellSize),
+		FMath::FloorToInt(Location.Y * InvCellSize),
+		FMath::FloorToInt(Location.Z * InvCellSize));
+}
+
+void FActorSpatialIndex::Bin(int32 Index)
+{
+	EntryOversize[Index] = IsOversize(Radii[Index]);
+	if (EntryOversize[Index])
+	{
+		OversizeEntries.Add(Index);
+		return;
+	}
+
+	EntryCells[Index] = GetCellCoord(Positions[Index]);
+	Cells.FindOrAdd(EntryCells[Index]).Add(Index);
+}
+
+void FActorSpatialIndex::Unbin(int32 Index)
+{
+	if (EntryOversize[Index])
+	{
+		OversizeEntries.RemoveSingleSwap(Index, EAllowShrinking::No);
+		return;
+	}
+
+	if (TArray<int32>* Bucket = Cells.Find(EntryCells[Index]))
+	{
+		Bucket->RemoveSingleSwap(Index, EAllowShrinking::No);
+		if (Bucket->Num() == 0)
+		{
+			Cells.Remove(EntryCells[Index]);
+		}
+	}
+}
+
+void FActorSpatialIndex::Rebin(int32 OldIndex, int32 NewIndex)
+{
+	TArray<int32>* Bucket = EntryOversize[NewIndex] ? &OversizeEntries : Cells.Find(EntryCells[NewIndex]);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	const int32 Slot = Bucket->Find(OldIndex);
+	if (Slot != INDEX_NONE)
+	{
+		(*Bucket)[Slot] = NewIndex;
+	}
+}
+
+void FActorSpatialIndex::RemoveAt(int32 Index)
+{
+	Unbin(Index);
+
+	// FObjectKey 在 Actor 销毁后仍可用于查表
+	IndexByActor.Remove(EntryKeys[Index]);
+
+	const int32 LastIndex = Actors.Num() - 1;
+	if (Index != LastIndex)
+	{
+		Positions[Index] = Positions[LastIndex];
+		Radii[Index] = Radii[LastIndex];
+		Actors[Index] = Actors[LastIndex];
+		EntryKeys[Index] = EntryKeys[LastIndex];
+		BoundsComponents[Index] = BoundsComponents[LastIndex];
+		EntryCells[Index] = EntryCells[LastIndex];
+		EntryOversize[Index] = EntryOversize[LastIndex];
+
+		Rebin(LastIndex, Index);
+		IndexByActor.Add(EntryKeys[Index], Index);
+	}
+
+	Positions.Pop(EAllowShrinking::No);
+	Radii.Pop(EAllowShrinking::No);
+	Actors.Pop(EAllowShrinking::No);
+	EntryKeys.Pop(EAllowShrinking::No);
+	BoundsComponents.Pop(EAllowShrinking::No);
+	EntryCells.Pop(EAllowShrinking::No);
+	EntryOversize.Pop(EAllowShrinking::No);
+}
@@ -9,6 +9,9 @@
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Game/CollisionConfig.h"
+#include "Grabber/GrabbableRegistrySubsystem.h"
+#include "Skill/Stasis/StasisableRegistrySubsystem.h"
+#include "Skill/Stasis/StasisSubsystem.h"
 
 // ==================== IGrabbable 接口实现 ====================
 
@@ -23,6 +26,20 @@ ABaseEnemy::ABaseEnemy()
 	GetMesh()->SetGenerateOverlapEvents(true);
 }
 
+void ABaseEnemy::BeginPlay()
+{
+	Super::BeginPlay();
+	UGrabbableRegistrySubsystem::RegisterGrabbable(this);
+	UStasisableRegistrySubsystem::RegisterStasisable(this);
+}
+
+void ABaseEnemy::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UGrabbableRegistrySubsystem::UnregisterGrabbable(this);
+	UStasisableRegistrySubsystem::UnregisterStasisable(this);
+	Super::EndPlay(EndPlayReason);
+}
+
 EGrabType ABaseEnemy::GetGrabType_Implementation() const
 {
 	return EGrabType::HumanBody;
@@ -73,12 +90,12 @@ void ABaseEnemy::OnReleased_Implementation(UPlayerGrabHand* Hand)
 	}
 }
 
-void ABaseEnemy::OnGrabSelected_Implementation()
+void ABaseEnemy::OnGrabSelected_Implementation(UPlayerGrabHand* Hand)
 {
 	// 尸体不需要选中效果，空实现
 }
 
-void ABaseEnemy::OnGrabDeselected_Implementation()
+void ABaseEnemy::OnGrabDeselected_Implementation(UPlayerGrabHand* Hand)
 {
 	// 尸体不需要取消选中效果，空实现
 }
@@ -91,12 +108,20 @@ void ABaseEnemy::EnterStasis_Implementation(double TimeToStasis)
 		return;
 	}
 
-	bIsInStasis = true;
-	// TODO: 活着的敌人被定身逻辑
+	// 时间膨胀定身：动画/移动/AI Tick 全部停住
+	if (UStasisSubsystem* Stasis = UStasisSubsystem::Get(this))
+	{
+		bIsInStasis = Stasis->Freeze(this, TimeToStasis);
+	}
 }
 
 void ABaseEnemy::ExitStasis_Implementation()
 {
+	if (UStasisSubsystem* Stasis = UStasisSubsystem::Get(this))
+	{
+		Stasis->Release(this);
+	}
+
 	if (bIsDead)
 	{
 		EnterRagdollMode();
@@ -104,7 +129,6 @@ void ABaseEnemy::ExitStasis_Implementation()
 	}
 	
 	bIsInStasis = false;
-	// TODO: 活着的敌人退出定身逻辑
 }
 
 bool ABaseEnemy::IsInStasis_Implementation()
@@ -7,6 +7,7 @@
 #include "Grabbee/GrabbeeObject.h"
 #include "Grabbee/Bow.h"
 #include "Grabbee/Arrow.h"
+#include "Grabbee/ArrowPoolSubsystem.h"
 #include "Camera/CameraComponent.h"
 #include "Components/SphereComponent.h"
 #include "DrawDebugHelpers.h"
@@ -424,7 +425,7 @@ void ABasePCPlayer::StopAiming()
 		{
 			InventoryComponent->TryStoreArrow();
 		}
-		HeldArrow->Destroy();
+		UArrowPoolSubsystem::ReturnToPoolOrDestroy(HeldArrow);
 	}
 }
 
@@ -531,6 +532,7 @@ void ABasePCPlayer::UpdateTargetDetection()
 {
 	FHitResult Hit;
 	AActor* NewTarget = nullptr;
+	UPCGrabHand* NewTargetHand = nullptr;
 	FName NewBoneName = NAME_None;
 	FVector NewImpactPoint = FVector::ZeroVector;
 
@@ -561,10 +563,11 @@ void ABasePCPlayer::UpdateTargetDetection()
 		{
 			if (Cast<IGrabbable>(TargetedObject))
 			{
-				IGrabbable::Execute_OnGrabDeselected(TargetedObject);
+				IGrabbable::Execute_OnGrabDeselected(TargetedObject, TargetedByHand);
 			}
 		}
 		TargetedObject = nullptr;
+		TargetedByHand = nullptr;
 		TargetedBoneName = NAME_None;
 		TargetedImpactPoint = FVector::ZeroVector;
 		return;
@@ -581,6 +584,7 @@ void ABasePCPlayer::UpdateTargetDetection()
 			if (IGrabbable::Execute_CanBeGrabbedBy(HitActor, CheckHand))
 			{
 				NewTarget = HitActor;
+				NewTargetHand = CheckHand;
 				NewBoneName = Hit.BoneName;
 				NewImpactPoint = Hit.ImpactPoint;
 			}
@@ -590,7 +594,9 @@ void ABasePCPlayer::UpdateTargetDetection()
 	if (NewTarget != TargetedObject)
 	{
 		AActor* OldTarget = TargetedObject;
+		UPCGrabHand* OldTargetHand = TargetedByHand;
 		TargetedObject = NewTarget;
+		TargetedByHand = NewTargetHand;
 		TargetedBoneName = NewBoneName;
 		TargetedImpactPoint = NewImpactPoint;
 
@@ -598,14 +604,14 @@ void ABasePCPlayer::UpdateTargetDetection()
 		{
 			if (Cast<IGrabbable>(OldTarget))
 			{
-				IGrabbable::Execute_OnGrabDeselected(OldTarget);
+				IGrabbable::Execute_OnGrabDeselected(OldTarget, OldTargetHand);
 			}
 		}
 		if (NewTarget && IsValid(NewTarget))
 		{
 			if (Cast<IGrabbable>(NewTarget))
 			{
-				IGrabbable::Execute_OnGrabSelected(NewTarget);
+				IGrabbable::Execute_OnGrabSelected(NewTarget, NewTargetHand);
 			}
 		}
 	}
@@ -651,14 +657,16 @@ void ABasePCPlayer::OnHandGrabbedObject(AActor* GrabbedObject)
 	if (TargetedObject && IsValid(TargetedObject))
 	{
 		AActor* OldTarget = TargetedObject;
+		UPCGrabHand* OldTargetHand = TargetedByHand;
 		TargetedObject = nullptr;
+		TargetedByHand = nullptr;
 		TargetedBoneName = NAME_None;
 		TargetedImpactPoint = FVector::ZeroVector;
 
 		// 鍙栨秷閫変腑鐘舵€侊紙閫氳繃鎺ュ彛锛?
 		if (Cast<IGrabbable>(OldTarget))
 		{
-			IGrabbable::Execute_OnGrabDeselected(OldTarget);
+			IGrabbable::Execute_OnGrabDeselected(OldTarget, OldTargetHand);
 		}
 	}
 }
@@ -32,13 +32,19 @@ ABaseVRPlayer::ABaseVRPlayer()
 	CameraCollision->SetGenerateOverlapEvents(true);
 	CameraCollision->SetCanEverAffectNavigation(false);
 
-	// 创建背包碰撞区域（在蓝图设置变换）
+	// 创建背包区域（在蓝图设置变换）：只作为形状，由 UpdateBodyZones 解析检测
 	BackpackCollision = CreateDefaultSubobject<UBoxComponent>(TEXT("BackpackCollision"));
 	BackpackCollision->SetupAttachment(VRCamera);
-	BackpackCollision->SetCollisionProfileName(CP_PLAYER_BACKPACK);
-	BackpackCollision->SetGenerateOverlapEvents(true);
-	BackpackCollision->OnComponentBeginOverlap.AddDynamic(this, &ABaseVRPlayer::OnBackpackBeginOverlap);
-	BackpackCollision->OnComponentEndOverlap.AddDynamic(this, &ABaseVRPlayer::OnBackpackEndOverlap);
+	BackpackCollision->SetCollisionProfileName(CP_NO_COLLISION);
+	BackpackCollision->SetGenerateOverlapEvents(false);
+	BackpackCollision->SetCanEverAffectNavigation(false);
+
+	// 默认身体区域：右肩后的箭袋
+	FVRBodyZone QuiverZone;
+	QuiverZone.Zone = EVRBodyZone::Quiver;
+	QuiverZone.Center = FVector(-15.0f, 15.0f, -5.0f);
+	QuiverZone.HalfExtent = FVector(12.0f, 12.0f, 20.0f);
+	BodyZones.Add(QuiverZone);
 
 	// 创建左手 MotionController
 	MotionControllerLeft = CreateDefaultSubobject<UMotionControllerComponent>(TEXT("MotionControllerLeft"));
@@ -120,6 +126,7 @@ void ABaseVRPlayer::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 
 	UpdateCapsuleToCamera();
+	UpdateBodyZones();
 }
 
 void ABaseVRPlayer::UpdateCapsuleToCamera()
@@ -228,41 +235,81 @@ void ABaseVRPlayer::SetVRHandRotationOffset(FRotator RotationOffset)
 	VRRightHand->SetRelativeRotation(RotationOffset);
 }
 
-void ABaseVRPlayer::OnBackpackBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
+// ==================== 身体区域 ====================
+
+void ABaseVRPlayer::UpdateBodyZones()
 {
-	if (!OtherComp || OtherComp->GetCollisionObjectType() != OCC_PLAYER_HAND)
+	if (!VRCamera)
 	{
 		return;
 	}
 
-	if (UVRGrabHand* Hand = GetHandFromCollision(OtherComp))
+	const FTransform BodyFrame = VRBodyZone::MakeBodyFrame(VRCamera->GetComponentLocation(), VRCamera->GetComponentRotation());
+	const FTransform BackpackFrame = BackpackCollision ? BackpackCollision->GetComponentTransform() : FTransform::Identity;
+
+	for (UVRGrabHand* Hand : { VRLeftHand, VRRightHand })
 	{
-		Hand->bIsInBackpackArea = true;
-		PlaySimpleForceFeedback(Hand->bIsRightHand ? EControllerHand::Right : EControllerHand::Left);
+		if (!Hand)
+		{
+			continue;
+		}
+
+		const EVRBodyZone NewZone = FindBodyZone(Hand, BodyFrame, BackpackFrame);
+		if (Hand->SetBodyZone(NewZone) && NewZone != EVRBodyZone::None)
+		{
+			PlaySimpleForceFeedback(Hand->bIsRightHand ? EControllerHand::Right : EControllerHand::Left);
+		}
 	}
 }
 
-void ABaseVRPlayer::OnBackpackEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-	UPrimitiveComponent* OtherComp, int32 OtherBodyIndex)
+EVRBodyZone ABaseVRPlayer::FindBodyZone(const UVRGrabHand* Hand, const FTransform& BodyFrame, const FTransform& BackpackFrame) const
 {
-	if (!OtherComp || OtherComp->GetCollisionObjectType() != OCC_PLAYER_HAND)
+	const FVector HandLocation = Hand->GetComponentLocation();
+	const float HandRadius = Hand->HandCollision ? Hand->HandCollision->GetScaledSphereRadius() : 0.0f;
+	const EVRBodyZone CurrentZone = Hand->CurrentBodyZone;
+	EVRBodyZone FoundZone = EVRBodyZone::None;
+
+	auto TestZone = [&](const FVRBodyZone& Zone, const FVector& LocalPoint)
 	{
-		return;
-	}
+		if (!Zone.AcceptsHand(Hand->bIsRightHand))
+		{
+			return false;
+		}
 
-	if (UVRGrabHand* Hand = GetHandFromCollision(OtherComp))
+		// 当前所在的区域使用更大的半径，离开需要越过退出余量
+		const bool bIsCurrent = Zone.Zone == CurrentZone;
+		if (!Zone.Overlaps(LocalPoint, bIsCurrent ? HandRadius + BodyZoneExitMargin : HandRadius))
+		{
+			return false;
+		}
+
+		if (bIsCurrent || FoundZone == EVRBodyZone::None)
+		{
+			FoundZone = Zone.Zone;
+		}
+		return bIsCurrent;
+	};
+
+	// 背包：形状取自 BackpackCollision（跟随 HMD 完整旋转，与原先的碰撞体一致）
+	if (BackpackCollision)
 	{
-		Hand->bIsInBackpackArea = false;
+		FVRBodyZone BackpackZone;
+		BackpackZone.Zone = EVRBodyZone::Backpack;
+		BackpackZone.HalfExtent = BackpackCollision->GetScaledBoxExtent();
+		if (TestZone(BackpackZone, BackpackFrame.InverseTransformPositionNoScale(HandLocation)))
+		{
+			return FoundZone;
+		}
 	}
-}
 
-UVRGrabHand* ABaseVRPlayer::GetHandFromCollision(UPrimitiveComponent* Comp) const
-{
-	if (!Comp)
+	const FVector BodyLocal = BodyFrame.InverseTransformPositionNoScale(HandLocation);
+	for (const FVRBodyZone& Zone : BodyZones)
 	{
-		return nullptr;
+		if (TestZone(Zone, BodyLocal))
+		{
+			return FoundZone;
+		}
 	}
 
-	return Cast<UVRGrabHand>(Comp->GetAttachParent());
+	return FoundZone;
 }
@@ -3,6 +3,7 @@
 #include "Game/GameSettings.h"
 #include "Grabbee/Bow.h"
 #include "Grabbee/Arrow.h"
+#include "Grabbee/ArrowImpactAsset.h"
 #include "Skill/SkillAsset.h"
 #include "Materials/MaterialInterface.h"
 
@@ -35,6 +36,11 @@ TSubclassOf<AArrow> UGameSettings::GetArrowClass() const
 	return ArrowClass.LoadSynchronous();
 }
 
+UArrowImpactAsset* UGameSettings::GetArrowImpactAsset() const
+{
+	return ArrowImpactAsset.IsNull() ? nullptr : ArrowImpactAsset.LoadSynchronous();
+}
+
 USkillAsset* UGameSettings::GetSkillAsset() const
 {
 	if (SkillAsset.IsNull())
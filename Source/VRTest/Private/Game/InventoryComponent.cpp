@@ -4,6 +4,7 @@
 
 #include "Game/GameSettings.h"
 #include "Grabbee/Arrow.h"
+#include "Grabbee/ArrowPoolSubsystem.h"
 #include "Grabbee/GrabbeeObject.h"
 
 UInventoryComponent::UInventoryComponent()
@@ -40,6 +41,15 @@ AGrabbeeObject* UInventoryComponent::TryRetrieveArrow(const FTransform& SpawnTra
 
 	ArrowCount--;
 
+	// 优先从对象池取箭，避免连射时 SpawnActor 卡顿
+	if (UArrowPoolSubsystem* ArrowPool = UArrowPoolSubsystem::Get(this))
+	{
+		if (AArrow* PooledArrow = ArrowPool->AcquireArrow(SpawnTransform, GetOwner(), Cast<APawn>(GetOwner())))
+		{
+			return PooledArrow;
+		}
+	}
+
 	FActorSpawnParameters SpawnParams;
 	SpawnParams.Owner = GetOwner();
 	SpawnParams.Instigator = Cast<APawn>(GetOwner());
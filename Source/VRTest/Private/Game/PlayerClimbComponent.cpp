@@ -8,8 +8,12 @@
 #include "Game/Characters/BasePCPlayer.h"
 #include "Game/Characters/BasePlayer.h"
 #include "Grabber/PlayerGrabHand.h"
+#include "Scene/ClimbableVolume.h"
+#include "Game/VRTestStats.h"
 #include "Engine/World.h"
 
+// ==================== 组件 ====================
+
 UPlayerClimbComponent::UPlayerClimbComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -31,9 +35,21 @@ void UPlayerClimbComponent::RegisterClimbGrip(UPlayerGrabHand* Hand, AActor* Cli
 	}
 
 	CleanupInvalidHands();
-	const int32 CountBefore = HandRecords.Num();
+	const int32 CountBefore = Grips.Num();
+
+	int32 GripIndex = FindGripIndex(Hand);
+	if (GripIndex == INDEX_NONE)
+	{
+		if (Grips.Num() >= MaxClimbGrips)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("PlayerClimbComponent: Too many climb grips, ignoring %s"), *Hand->GetName());
+			return;
+		}
+		GripIndex = Grips.AddDefaulted();
+	}
 
-	FPlayerClimbHandRecord& Record = HandRecords.FindOrAdd(Hand);
+	FPlayerClimbHandRecord& Record = Grips[GripIndex];
+	Record.Hand = Hand;
 	Record.GrabPointWorld = Hand->GetComponentLocation();
 	Record.bIsRightHand = Hand->bIsRightHand;
 	Record.ClimbActor = ClimbActor;
@@ -46,11 +62,22 @@ void UPlayerClimbComponent::RegisterClimbGrip(UPlayerGrabHand* Hand, AActor* Cli
 		}
 	}
 
-	ActiveHand = Hand;
+	// 吸附到烘焙的抓点
+	if (const AClimbableVolume* Volume = Cast<AClimbableVolume>(ClimbActor))
+	{
+		FVector GripLocation;
+		FVector GripNormal;
+		if (Volume->FindNearestGripPoint(Record.GrabPointWorld, Volume->GetGripSnapDistance(), GripLocation, GripNormal))
+		{
+			Record.GrabPointWorld = GripLocation;
+		}
+	}
+
+	ActiveGripIndex = GripIndex;
 	bLandingRecover = false;
 	LandingElapsed = 0.0f;
 
-	if (CountBefore <= 0 && HandRecords.Num() > 0)
+	if (CountBefore <= 0 && Grips.Num() > 0)
 	{
 		OwnerPlayer->EnterClimbState();
 	}
@@ -67,21 +94,19 @@ void UPlayerClimbComponent::UnregisterClimbGrip(UPlayerGrabHand* Hand, AActor* C
 
 	CleanupInvalidHands();
 
-	if (FPlayerClimbHandRecord* Existing = HandRecords.Find(Hand))
+	const int32 GripIndex = FindGripIndex(Hand);
+	if (GripIndex != INDEX_NONE)
 	{
-		if (!ClimbActor || !Existing->ClimbActor.IsValid() || Existing->ClimbActor.Get() == ClimbActor)
+		const FPlayerClimbHandRecord& Existing = Grips[GripIndex];
+		if (!ClimbActor || !Existing.ClimbActor.IsValid() || Existing.ClimbActor.Get() == ClimbActor)
 		{
-			HandRecords.Remove(Hand);
+			RemoveGripAt(GripIndex);
 		}
 	}
-	else
-	{
-		HandRecords.Remove(Hand);
-	}
 
 	CleanupInvalidHands();
 
-	if (HandRecords.Num() > 0)
+	if (Grips.Num() > 0)
 	{
 		PromoteActiveHand(Hand->OtherHand);
 		SetComponentTickEnabled(true);
@@ -94,7 +119,7 @@ void UPlayerClimbComponent::UnregisterClimbGrip(UPlayerGrabHand* Hand, AActor* C
 bool UPlayerClimbComponent::HasAnyValidClimbGrip()
 {
 	CleanupInvalidHands();
-	return HandRecords.Num() > 0;
+	return Grips.Num() > 0;
 }
 
 void UPlayerClimbComponent::TryExitClimbStateIfNoValidGrip()
@@ -106,7 +131,7 @@ void UPlayerClimbComponent::TryExitClimbStateIfNoValidGrip()
 		return;
 	}
 
-	if (HandRecords.Num() <= 0 && !bLandingRecover)
+	if (Grips.Num() <= 0 && !bLandingRecover)
 	{
 		OwnerPlayer->ExitClimbState();
 	}
@@ -126,7 +151,7 @@ void UPlayerClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 
 	if (bLandingRecover)
 	{
-		if (HandRecords.Num() > 0)
+		if (Grips.Num() > 0)
 		{
 			bLandingRecover = false;
 			LandingElapsed = 0.0f;
@@ -138,13 +163,13 @@ void UPlayerClimbComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		return;
 	}
 
-	if (HandRecords.Num() <= 0)
+	if (Grips.Num() <= 0)
 	{
 		BeginLandingRecover();
 		return;
 	}
 
-	if (!ActiveHand.IsValid() || !HandRecords.Contains(ActiveHand))
+	if (!Grips.IsValidIndex(ActiveGripIndex))
 	{
 		PromoteActiveHand();
 	}
@@ -167,7 +192,7 @@ void UPlayerClimbComponent::BeginLandingRecover()
 		return;
 	}
 
-	if (HandRecords.Num() > 0)
+	if (Grips.Num() > 0)
 	{
 		return;
 	}
@@ -180,7 +205,7 @@ void UPlayerClimbComponent::BeginLandingRecover()
 	}
 
 	float GroundZ = 0.0f;
-	if (!TraceGroundZ(GroundZ))
+	if (!FindLandingGroundZ(GroundZ))
 	{
 		StopClimb();
 		return;
@@ -259,15 +284,15 @@ void UPlayerClimbComponent::UpdateLandingRecover(float DeltaSeconds)
 
 void UPlayerClimbComponent::StopClimb()
 {
-	const bool bHadAnyGrip = HandRecords.Num() > 0;
+	const bool bHadAnyGrip = Grips.Num() > 0;
 
 	bLandingRecover = false;
 	LandingElapsed = 0.0f;
 	LandingStartZ = 0.0f;
 	LandingTargetZ = 0.0f;
 	LandingNoProgressElapsed = 0.0f;
-	ActiveHand.Reset();
-	HandRecords.Reset();
+	ActiveGripIndex = INDEX_NONE;
+	Grips.Reset();
 
 	if (OwnerPlayer && !bHadAnyGrip)
 	{
@@ -279,17 +304,13 @@ void UPlayerClimbComponent::StopClimb()
 
 void UPlayerClimbComponent::HandleVRClimb()
 {
-	if (!OwnerPlayer || !ActiveHand.IsValid())
-	{
-		return;
-	}
-
-	FPlayerClimbHandRecord* ActiveRecord = HandRecords.Find(ActiveHand);
-	if (!ActiveRecord)
+	const UPlayerGrabHand* ActiveHand = GetActiveHand();
+	if (!OwnerPlayer || !ActiveHand)
 	{
 		return;
 	}
 
+	const FPlayerClimbHandRecord* ActiveRecord = &Grips[ActiveGripIndex];
 	const FVector HandLocation = ActiveHand->GetComponentLocation();
 	FVector PullDelta = ActiveRecord->GrabPointWorld - HandLocation;
 	PullDelta = PullDelta.GetClampedToMaxSize(VRMaxPullPerTick);
@@ -316,54 +337,60 @@ void UPlayerClimbComponent::EnforcePCReachConstraints()
 	const ABasePCPlayer* PCPlayer = Cast<ABasePCPlayer>(OwnerPlayer.Get());
 	const UCameraComponent* CameraComp = PCPlayer ? PCPlayer->FirstPersonCamera : nullptr;
 
-	const int32 Iterations = FMath::Max(1, PCConstraintIterations);
-	for (int32 Iter = 0; Iter < Iterations; ++Iter)
+	const FVector CameraLoc = CameraComp ? CameraComp->GetComponentLocation() : OwnerPlayer->GetActorLocation();
+
+	FVector TotalCorrection = FVector::ZeroVector;
 	{
-		const FVector CameraLoc = CameraComp ? CameraComp->GetComponentLocation() : OwnerPlayer->GetActorLocation();
-		FVector TotalCorrection = FVector::ZeroVector;
+		SCOPE_CYCLE_COUNTER(STAT_VRTest_ClimbSolve);
+		const uint64 StartCycles = FPlatformTime::Cycles64();
 
-		if (ActiveHand.IsValid())
+		// 抓点与臂展平方一次性取出，迭代中只做向量运算
+		FVector GripPoints[MaxClimbGrips];
+		int32 NumGripPoints = 0;
+		for (const FPlayerClimbHandRecord& Record : Grips)
 		{
-			if (const FPlayerClimbHandRecord* ActiveRecord = HandRecords.Find(ActiveHand))
-			{
-				const FVector ToCamera = CameraLoc - ActiveRecord->GrabPointWorld;
-				const float Dist = ToCamera.Size();
-				if (Dist > PCArmReachRadius && Dist > KINDA_SMALL_NUMBER)
-				{
-					const float Excess = Dist - PCArmReachRadius;
-					TotalCorrection += -ToCamera.GetSafeNormal() * Excess;
-				}
-			}
+			GripPoints[NumGripPoints++] = Record.GrabPointWorld;
 		}
+		const float ReachSq = FMath::Square(PCArmReachRadius);
 
-		for (const TPair<TWeakObjectPtr<UPlayerGrabHand>, FPlayerClimbHandRecord>& Pair : HandRecords)
+		// 逐个把相机投影回每个抓点的臂展球内（Gauss-Seidel），固定迭代次数，收敛即停
+		FVector SolvedCamera = CameraLoc;
+		const int32 Iterations = FMath::Max(1, PCConstraintIterations);
+		int32 Iter = 0;
+		while (Iter < Iterations)
 		{
-			const TWeakObjectPtr<UPlayerGrabHand>& HandKey = Pair.Key;
-			const FPlayerClimbHandRecord& Record = Pair.Value;
-			if (!HandKey.IsValid())
+			++Iter;
+			const FVector IterStart = SolvedCamera;
+			bool bProjected = false;
+			for (int32 Index = 0; Index < NumGripPoints; ++Index)
 			{
-				continue;
+				const FVector ToCamera = SolvedCamera - GripPoints[Index];
+				const float DistSq = ToCamera.SizeSquared();
+				if (DistSq > ReachSq && DistSq > KINDA_SMALL_NUMBER)
+				{
+					SolvedCamera = GripPoints[Index] + ToCamera * (PCArmReachRadius * FMath::InvSqrt(DistSq));
+					bProjected = true;
+				}
 			}
-			if (ActiveHand.IsValid() && HandKey == ActiveHand)
+			if (!bProjected)
 			{
-				continue;
+				break;
 			}
 
-			const FVector ToCamera = CameraLoc - Record.GrabPointWorld;
-			const float Dist = ToCamera.Size();
-			if (Dist > PCArmReachRadius && Dist > KINDA_SMALL_NUMBER)
-			{
-				const float Excess = Dist - PCArmReachRadius;
-				TotalCorrection += -ToCamera.GetSafeNormal() * Excess;
-			}
+			// 每次迭代单独限幅
+			SolvedCamera = IterStart + (SolvedCamera - IterStart).GetClampedToMaxSize(PCMaxCorrectionPerTick);
 		}
 
-		TotalCorrection = TotalCorrection.GetClampedToMaxSize(PCMaxCorrectionPerTick);
-		if (TotalCorrection.IsNearlyZero())
-		{
-			break;
-		}
+		TotalCorrection = SolvedCamera - CameraLoc;
+
+		LastSolverIterations = Iter;
+		LastSolverTimeMs = static_cast<float>(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+		INC_DWORD_STAT_BY(STAT_VRTest_ClimbSolverIterations, Iter);
+	}
 
+	// 只做一次带扫掠的位移
+	if (!TotalCorrection.IsNearlyZero())
+	{
 		ApplyPlayerOffset(TotalCorrection, true);
 
 		if (bDebugDraw)
@@ -383,15 +410,10 @@ void UPlayerClimbComponent::EnforcePCReachConstraints()
 
 	if (bDebugDraw)
 	{
-		const FVector CameraLoc = CameraComp ? CameraComp->GetComponentLocation() : OwnerPlayer->GetActorLocation();
-		for (const TPair<TWeakObjectPtr<UPlayerGrabHand>, FPlayerClimbHandRecord>& Pair : HandRecords)
+		for (const FPlayerClimbHandRecord& Record : Grips)
 		{
-			if (!Pair.Key.IsValid())
-			{
-				continue;
-			}
-			DrawDebugSphere(GetWorld(), Pair.Value.GrabPointWorld, PCArmReachRadius, 16, FColor::Green, false, 0.0f);
-			DrawDebugLine(GetWorld(), Pair.Value.GrabPointWorld, CameraLoc, FColor::Green, false, 0.0f, 0, 1.0f);
+			DrawDebugSphere(GetWorld(), Record.GrabPointWorld, PCArmReachRadius, 16, FColor::Green, false, 0.0f);
+			DrawDebugLine(GetWorld(), Record.GrabPointWorld, CameraLoc, FColor::Green, false, 0.0f, 0, 1.0f);
 		}
 	}
 }
@@ -452,47 +474,88 @@ bool UPlayerClimbComponent::TraceGroundZ(float& OutGroundZ) const
 	return true;
 }
 
-void UPlayerClimbComponent::CleanupInvalidHands()
+bool UPlayerClimbComponent::FindLandingGroundZ(float& OutGroundZ) const
+{
+	const AClimbableVolume* Volume = Cast<AClimbableVolume>(LastClimbActor.Get());
+	const UCapsuleComponent* Capsule = OwnerPlayer ? OwnerPlayer->GetCapsuleComponent() : nullptr;
+	if (Volume && Capsule)
+	{
+		const UCameraComponent* CameraComp = OwnerPlayer->PlayerCamera;
+		const FVector Start = CameraComp ? CameraComp->GetComponentLocation() : Capsule->GetComponentLocation();
+		const float MaxDrop = LandingTraceDistance + Capsule->GetScaledCapsuleHalfHeight() + 10.0f;
+		if (Volume->FindLandingSurfaceZ(Start, LandingGripSearchRadius, MaxDrop, OutGroundZ))
+		{
+			if (bDebugDraw)
+			{
+				DrawDebugPoint(GetWorld(), FVector(Start.X, Start.Y, OutGroundZ), 8.0f, FColor::Cyan, false, 0.5f);
+			}
+			return true;
+		}
+	}
+
+	return TraceGroundZ(OutGroundZ);
+}
+
+int32 UPlayerClimbComponent::FindGripIndex(const UPlayerGrabHand* Hand) const
 {
-	TArray<TWeakObjectPtr<UPlayerGrabHand>> InvalidHands;
-	for (const TPair<TWeakObjectPtr<UPlayerGrabHand>, FPlayerClimbHandRecord>& Pair : HandRecords)
+	for (int32 Index = 0; Index < Grips.Num(); ++Index)
 	{
-		const UPlayerGrabHand* Hand = Pair.Key.Get();
-		const AActor* ClimbActor = Pair.Value.ClimbActor.Get();
-		if (!Pair.Key.IsValid() || !Pair.Value.ClimbActor.IsValid() || !Hand || !ClimbActor || !Hand->bIsHolding || Hand->HeldActor != ClimbActor)
+		if (Grips[Index].Hand.Get() == Hand)
 		{
-			InvalidHands.Add(Pair.Key);
+			return Index;
 		}
 	}
+	return INDEX_NONE;
+}
+
+void UPlayerClimbComponent::RemoveGripAt(int32 GripIndex)
+{
+	const int32 LastIndex = Grips.Num() - 1;
+	if (Grips[GripIndex].ClimbActor.IsValid())
+	{
+		LastClimbActor = Grips[GripIndex].ClimbActor;
+	}
+	Grips.RemoveAtSwap(GripIndex, 1, EAllowShrinking::No);
 
-	for (const TWeakObjectPtr<UPlayerGrabHand>& Hand : InvalidHands)
+	if (ActiveGripIndex == GripIndex)
+	{
+		ActiveGripIndex = INDEX_NONE;
+	}
+	else if (ActiveGripIndex == LastIndex)
 	{
-		HandRecords.Remove(Hand);
+		ActiveGripIndex = GripIndex;
 	}
 }
 
-void UPlayerClimbComponent::PromoteActiveHand(UPlayerGrabHand* PreferredHand)
+void UPlayerClimbComponent::CleanupInvalidHands()
 {
-	if (PreferredHand)
+	for (int32 Index = Grips.Num() - 1; Index >= 0; --Index)
 	{
-		for (const TPair<TWeakObjectPtr<UPlayerGrabHand>, FPlayerClimbHandRecord>& Pair : HandRecords)
+		const UPlayerGrabHand* Hand = Grips[Index].Hand.Get();
+		const AActor* ClimbActor = Grips[Index].ClimbActor.Get();
+		if (!Hand || !ClimbActor || !Hand->bIsHolding || Hand->HeldActor != ClimbActor)
 		{
-			if (Pair.Key.Get() == PreferredHand)
-			{
-				ActiveHand = Pair.Key;
-				return;
-			}
+			RemoveGripAt(Index);
 		}
 	}
+}
 
-	for (const TPair<TWeakObjectPtr<UPlayerGrabHand>, FPlayerClimbHandRecord>& Pair : HandRecords)
+void UPlayerClimbComponent::PromoteActiveHand(UPlayerGrabHand* PreferredHand)
+{
+	if (PreferredHand)
 	{
-		if (Pair.Key.IsValid())
+		const int32 PreferredIndex = FindGripIndex(PreferredHand);
+		if (PreferredIndex != INDEX_NONE)
 		{
-			ActiveHand = Pair.Key;
+			ActiveGripIndex = PreferredIndex;
 			return;
 		}
 	}
 
-	ActiveHand.Reset();
+	ActiveGripIndex = Grips.Num() > 0 ? 0 : INDEX_NONE;
+}
+
+UPlayerGrabHand* UPlayerClimbComponent::GetActiveHand() const
+{
+	return Grips.IsValidIndex(ActiveGripIndex) ? Grips[ActiveGripIndex].Hand.Get() : nullptr;
 }
@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/ProjectileSimulation.h"
+
+FVector FProjectileSimulation::ComputeAcceleration(const FProjectileSimState& State, const FProjectileSimParams& Params)
+{
+	FVector Acceleration(0.0f, 0.0f, Params.GravityZ);
+
+	if (Params.LinearDrag > 0.0f)
+	{
+		Acceleration -= State.Velocity * Params.LinearDrag;
+	}
+
+	if (Params.bHoming)
+	{
+		const FVector ToTarget = Params.HomingTarget - State.Location;
+		const float Distance = ToTarget.Size();
+		const FVector Direction = Distance > KINDA_SMALL_NUMBER ? ToTarget / Distance : FVector::ZeroVector;
+		const float ClampedDistance = FMath::Clamp(Distance, Params.HomingDistanceMin, Params.HomingDistanceMax);
+		Acceleration += Direction * Params.HomingStiffness * ClampedDistance - State.Velocity * Params.HomingDamping;
+	}
+
+	return Acceleration;
+}
+
+void FProjectileSimulation::Step(FProjectileSimState& State, const FProjectileSimParams& Params)
+{
+	const float Dt = Params.FixedTimeStep;
+
+	State.PreviousLocation = State.Location;
+	State.PreviousVelocity = State.Velocity;
+
+	State.Velocity += ComputeAcceleration(State, Params) * Dt;
+	if (Params.MaxSpeed > 0.0f)
+	{
+		State.Velocity = State.Velocity.GetClampedToMaxSize(Params.MaxSpeed);
+	}
+
+	State.Location += State.Velocity * Dt;
+	State.SimTime += Dt;
+}
+
+int32 FProjectileSimulation::Advance(FProjectileSimState& State, const FProjectileSimParams& Params, float DeltaTime)
+{
+	if (Params.FixedTimeStep <= 0.0f)
+	{
+		return 0;
+	}
+
+	State.TimeAccumulator += FMath::Max(DeltaTime, 0.0f);
+
+	int32 Steps = 0;
+	while (State.TimeAccumulator >= Params.FixedTimeStep && Steps < Params.MaxStepsPerAdvance)
+	{
+		Step(State, Params);
+		State.TimeAccumulator -= Params.FixedTimeStep;
+		++Steps;
+	}
+
+	// 追帧上限：丢弃剩余时间，保证单帧开销有界
+	if (Steps >= Params.MaxStepsPerAdvance)
+	{
+		State.TimeAccumulator = FMath::Min(State.TimeAccumulator, Params.FixedTimeStep);
+	}
+
+	return Steps;
+}
+
+float FProjectileSimulation::GetInterpolationAlpha(const FProjectileSimState& State, const FProjectileSimParams& Params)
+{
+	return Params.FixedTimeStep > 0.0f ? FMath::Clamp(State.TimeAccumulator / Params.FixedTimeStep, 0.0f, 1.0f) : 1.0f;
+}
+
+FVector FProjectileSimulation::InterpolateLocation(const FProjectileSimState& State, float Alpha)
+{
+	return FMath::Lerp(State.PreviousLocation, State.Location, Alpha);
+}
+
+FVector FProjectileSimulation::InterpolateVelocity(const FProjectileSimState& State, float Alpha)
+{
+	return FMath::Lerp(State.PreviousVelocity, State.Velocity, Alpha);
+}
+
+void FProjectileSimulation::PredictPath(const FProjectileSimState& Start, const FProjectileSimParams& Params, float MaxSimTime,
+	int32 StepsPerSample, TArray<FVector>& OutPoints)
+{
+	OutPoints.Reset();
+	if (Params.FixedTimeStep <= 0.0f)
+	{
+		return;
+	}
+
+	StepsPerSample = FMath::Max(1, StepsPerSample);
+	const int32 TotalSteps = FMath::CeilToInt(MaxSimTime / Params.FixedTimeStep);
+
+	FProjectileSimState State = Start;
+	OutPoints.Add(State.Location);
+	for (int32 StepIndex = 1; StepIndex <= TotalSteps; ++StepIndex)
+	{
+		Step(State, Params);
+		if (StepIndex % StepsPerSample == 0)
+		{
+			OutPoints.Add(State.Location);
+		}
+	}
+}
@@ -0,0 +1,298 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/ShapeQuery.h"
+#include "Game/VRTestStats.h"
+
+namespace ShapeQuery
+{
+	/** 距离平方小于该值时视为与原点重合（夹角按 0 处理） */
+	constexpr float CoincidentDistSq = 1.0e-4f;
+
+	/** 归一化后的余弦：与原点重合时为 1 */
+	FORCEINLINE VectorRegister4Float CosAngle(const VectorRegister4Float& Dot, const VectorRegister4Float& DistSq)
+	{
+		const VectorRegister4Float Coincident = VectorCompareLE(DistSq, VectorSetFloat1(CoincidentDistSq));
+		const VectorRegister4Float Cos = VectorMultiply(Dot, VectorReciprocalSqrt(VectorMax(DistSq, VectorSetFloat1(CoincidentDistSq))));
+		return VectorSelect(Coincident, VectorOneFloat(), Cos);
+	}
+
+	FORCEINLINE float CosAngle(float Dot, float DistSq)
+	{
+		return DistSq <= CoincidentDistSq ? 1.0f : Dot * FMath::InvSqrt(DistSq);
+	}
+
+	FORCEINLINE VectorRegister4Float Dot3(const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z, const FVector3f& N)
+	{
+		return VectorMultiplyAdd(Z, VectorSetFloat1(N.Z), VectorMultiplyAdd(Y, VectorSetFloat1(N.Y), VectorMultiply(X, VectorSetFloat1(N.X))));
+	}
+}
+
+// ==================== 构造 ====================
+
+FShapeQuery FShapeQuery::MakeCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees)
+{
+	FShapeQuery Query;
+	Query.Type = EShapeQueryType::Cone;
+	Query.Origin = Origin;
+	Query.Axis = FVector3f(Direction.GetSafeNormal());
+	Query.Range = Range;
+	Query.CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+	Query.bValid = !Query.Axis.IsNearlyZero() && Range > 0.0f;
+
+	// 半角小于 60 度时，过顶点与底面圆的球比以顶点为心的球小
+	if (Query.CosHalfAngle > 0.5f)
+	{
+		const float SphereRadius = Range / (2.0f * Query.CosHalfAngle);
+		Query.BoundsCenter = Origin + FVector(Query.Axis) * SphereRadius;
+		Query.BoundsRadius = SphereRadius;
+	}
+	else
+	{
+		Query.BoundsCenter = Origin;
+		Query.BoundsRadius = Range;
+	}
+	return Query;
+}
+
+FShapeQuery FShapeQuery::MakeSector(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees, float HalfHeight)
+{
+	FShapeQuery Query;
+	Query.Type = EShapeQueryType::Sector;
+	Query.Origin = Origin;
+	Query.Axis = FVector3f(FVector(Direction.X, Direction.Y, 0.0f).GetSafeNormal());
+	Query.Range = Range;
+	Query.CosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.0f, 180.0f)));
+	Query.HalfHeight = FMath::Max(HalfHeight, 0.0f);
+	Query.bValid = !Query.Axis.IsNearlyZero() && Range > 0.0f;
+	Query.BoundsCenter = Origin;
+	Query.BoundsRadius = FMath::Sqrt(FMath::Square(Range) + FMath::Square(Query.HalfHeight));
+	return Query;
+}
+
+FShapeQuery FShapeQuery::MakeCapsule(const FVector& Start, const FVector& End, float Radius)
+{
+	FShapeQuery Query;
+	Query.Type = EShapeQueryType::Capsule;
+	Query.Origin = Start;
+
+	// 线段退化为点时按球处理（方向任意）
+	const FVector Segment = End - Start;
+	const float Length = Segment.Size();
+	Query.Axis = Length > UE_KINDA_SMALL_NUMBER ? FVector3f(Segment / Length) : FVector3f::ForwardVector;
+	Query.Range = Length > UE_KINDA_SMALL_NUMBER ? Length : 0.0f;
+	Query.Radius = Radius;
+	Query.bValid = Radius >= 0.0f;
+	Query.BoundsCenter = Start + Segment * 0.5f;
+	Query.BoundsRadius = Query.Range * 0.5f + FMath::Max(Radius, 0.0f);
+	return Query;
+}
+
+FShapeQuery FShapeQuery::MakeFrustum(const FVector& Origin, const FRotator& Rotation, float HalfFOVDegrees, float AspectRatio, float NearDistance, float FarDistance)
+{
+	FShapeQuery Query;
+	Query.Type = EShapeQueryType::Frustum;
+	Query.Origin = Origin;
+
+	const FRotationMatrix Matrix(Rotation);
+	const FVector3f Forward(Matrix.GetUnitAxis(EAxis::X));
+	const FVector3f Right(Matrix.GetUnitAxis(EAxis::Y));
+	const FVector3f Up(Matrix.GetUnitAxis(EAxis::Z));
+
+	const float TanHalfH = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(HalfFOVDegrees, 0.1f, 89.0f)));
+	const float TanHalfV = TanHalfH / FMath::Max(AspectRatio, UE_KINDA_SMALL_NUMBER);
+	const float Near = FMath::Max(NearDistance, 0.0f);
+
+	Query.Axis = Forward;
+	Query.Range = FarDistance;
+	Query.bValid = FarDistance > Near;
+
+	// 侧面过原点，法线朝外；近/远平面沿视线
+	Query.Planes[0] = FVector4f(-Forward, -Near);
+	Query.Planes[1] = FVector4f(Forward, FarDistance);
+	Query.Planes[2] = FVector4f((-Right - Forward * TanHalfH).GetSafeNormal(), 0.0f);
+	Query.Planes[3] = FVector4f((Right - Forward * TanHalfH).GetSafeNormal(), 0.0f);
+	Query.Planes[4] = FVector4f((Up - Forward * TanHalfV).GetSafeNormal(), 0.0f);
+	Query.Planes[5] = FVector4f((-Up - Forward * TanHalfV).GetSafeNormal(), 0.0f);
+
+	// 包围球：圆心在视线中点，半径取到近/远平面四角的最大距离
+	const float MidDepth = (Near + FarDistance) * 0.5f;
+	const float CornerSpreadSq = FMath::Square(TanHalfH) + FMath::Square(TanHalfV);
+	const float NearCornerSq = FMath::Square(Near - MidDepth) + FMath::Square(Near) * CornerSpreadSq;
+	const float FarCornerSq = FMath::Square(FarDistance - MidDepth) + FMath::Square(FarDistance) * CornerSpreadSq;
+	Query.BoundsCenter = Origin + FVector(Forward) * MidDepth;
+	Query.BoundsRadius = FMath::Sqrt(FMath::Max(NearCornerSq, FarCornerSq));
+	return Query;
+}
+
+// ==================== 判定 ====================
+
+bool FShapeQuery::TestSphere(const FVector& Position, float EntryRadius, float& OutScore) const
+{
+	if (!bValid)
+	{
+		return false;
+	}
+
+	const FVector3f D(Position - Origin);
+
+	switch (Type)
+	{
+	case EShapeQueryType::Cone:
+	{
+		const float DistSq = D.SizeSquared();
+		if (DistSq > FMath::Square(Range + EntryRadius))
+		{
+			return false;
+		}
+		OutScore = ShapeQuery::CosAngle(FVector3f::DotProduct(D, Axis), DistSq);
+		return OutScore >= CosHalfAngle;
+	}
+	case EShapeQueryType::Sector:
+	{
+		const float HorizontalSq = FMath::Square(D.X) + FMath::Square(D.Y);
+		if (HorizontalSq > FMath::Square(Range + EntryRadius) || FMath::Abs(D.Z) > HalfHeight + EntryRadius)
+		{
+			return false;
+		}
+		OutScore = ShapeQuery::CosAngle(D.X * Axis.X + D.Y * Axis.Y, HorizontalSq);
+		return OutScore >= CosHalfAngle;
+	}
+	case EShapeQueryType::Capsule:
+	{
+		const float T = FMath::Clamp(FVector3f::DotProduct(D, Axis), 0.0f, Range);
+		OutScore = -T;
+		return (D - Axis * T).SizeSquared() <= FMath::Square(Radius + EntryRadius);
+	}
+	case EShapeQueryType::Frustum:
+	{
+		for (const FVector4f& Plane : Planes)
+		{
+			if (D.X * Plane.X + D.Y * Plane.Y + D.Z * Plane.Z - Plane.W > EntryRadius)
+			{
+				return false;
+			}
+		}
+		OutScore = -FVector3f::DotProduct(D, Axis);
+		return true;
+	}
+	}
+
+	return false;
+}
+
+uint32 FShapeQuery::TestBatch(const float* RESTRICT X, const float* RESTRICT Y, const float* RESTRICT Z, const float* RESTRICT R, float* RESTRICT OutScores) const
+{
+	using namespace ShapeQuery;
+
+	const VectorRegister4Float VX = VectorLoadAligned(X);
+	const VectorRegister4Float VY = VectorLoadAligned(Y);
+	const VectorRegister4Float VZ = VectorLoadAligned(Z);
+	const VectorRegister4Float VR = VectorLoadAligned(R);
+
+	VectorRegister4Float Inside;
+	VectorRegister4Float Score;
+
+	switch (Type)
+	{
+	case EShapeQueryType::Cone:
+	{
+		const VectorRegister4Float DistSq = VectorMultiplyAdd(VZ, VZ, VectorMultiplyAdd(VY, VY, VectorMultiply(VX, VX)));
+		const VectorRegister4Float Reach = VectorAdd(VR, VectorSetFloat1(Range));
+		Score = CosAngle(Dot3(VX, VY, VZ, Axis), DistSq);
+		Inside = VectorBitwiseAnd(
+			VectorCompareLE(DistSq, VectorMultiply(Reach, Reach)),
+			VectorCompareGE(Score, VectorSetFloat1(CosHalfAngle)));
+		break;
+	}
+	case EShapeQueryType::Sector:
+	{
+		const VectorRegister4Float HorizontalSq = VectorMultiplyAdd(VY, VY, VectorMultiply(VX, VX));
+		const VectorRegister4Float Reach = VectorAdd(VR, VectorSetFloat1(Range));
+		const VectorRegister4Float Dot = VectorMultiplyAdd(VY, VectorSetFloat1(Axis.Y), VectorMultiply(VX, VectorSetFloat1(Axis.X)));
+		Score = CosAngle(Dot, HorizontalSq);
+		Inside = VectorBitwiseAnd(
+			VectorBitwiseAnd(
+				VectorCompareLE(HorizontalSq, VectorMultiply(Reach, Reach)),
+				VectorCompareLE(VectorAbs(VZ), VectorAdd(VR, VectorSetFloat1(HalfHeight)))),
+			VectorCompareGE(Score, VectorSetFloat1(CosHalfAngle)));
+		break;
+	}
+	case EShapeQueryType::Capsule:
+	{
+		const VectorRegister4Float T = VectorMin(VectorMax(Dot3(VX, VY, VZ, Axis), VectorZeroFloat()), VectorSetFloat1(Range));
+		const VectorRegister4Float DX = VectorSubtract(VX, VectorMultiply(T, VectorSetFloat1(Axis.X)));
+		const VectorRegister4Float DY = VectorSubtract(VY, VectorMultiply(T, VectorSetFloat1(Axis.Y)));
+		const VectorRegister4Float DZ = VectorSubtract(VZ, VectorMultiply(T, VectorSetFloat1(Axis.Z)));
+		const VectorRegister4Float DistSq = VectorMultiplyAdd(DZ, DZ, VectorMultiplyAdd(DY, DY, VectorMultiply(DX, DX)));
+		const VectorRegister4Float Reach = VectorAdd(VR, VectorSetFloat1(Radius));
+		Score = VectorNegate(T);
+		Inside = VectorCompareLE(DistSq, VectorMultiply(Reach, Reach));
+		break;
+	}
+	case EShapeQueryType::Frustum:
+	{
+		Inside = VectorCompareEQ(VectorZeroFloat(), VectorZeroFloat());
+		for (const FVector4f& Plane : Planes)
+		{
+			const VectorRegister4Float PlaneDot = VectorSubtract(Dot3(VX, VY, VZ, FVector3f(Plane.X, Plane.Y, Plane.Z)), VectorSetFloat1(Plane.W));
+			Inside = VectorBitwiseAnd(Inside, VectorCompareLE(PlaneDot, VR));
+		}
+		Score = VectorNegate(Dot3(VX, VY, VZ, Axis));
+		break;
+	}
+	default:
+		return 0;
+	}
+
+	VectorStoreAligned(Score, OutScores);
+	return static_cast<uint32>(VectorMaskBits(Inside));
+}
+
+int32 FShapeQuery::TestEntries(const FActorSpatialIndex& Index, TConstArrayView<int32> Entries, FShapeQueryHit* OutHits) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_VRTest_ShapeQuery);
+
+	const TArray<FVector>& Positions = Index.GetPositions();
+	const TArray<float>& Radii = Index.GetRadii();
+
+	MS_ALIGN(16) float X[BatchSize] GCC_ALIGN(16);
+	MS_ALIGN(16) float Y[BatchSize] GCC_ALIGN(16);
+	MS_ALIGN(16) float Z[BatchSize] GCC_ALIGN(16);
+	MS_ALIGN(16) float R[BatchSize] GCC_ALIGN(16);
+	MS_ALIGN(16) float Scores[BatchSize] GCC_ALIGN(16);
+
+	int32 NumHits = 0;
+	for (int32 First = 0; First < Entries.Num(); First += BatchSize)
+	{
+		const int32 Count = FMath::Min(BatchSize, Entries.Num() - First);
+
+		// 打包成相对原点的 SoA；不足 4 个时补零，再用掩码去掉
+		for (int32 Lane = 0; Lane < BatchSize; ++Lane)
+		{
+			if (Lane < Count)
+			{
+				const int32 EntryIndex = Entries[First + Lane];
+				const FVector D = Positions[EntryIndex] - Origin;
+				X[Lane] = static_cast<float>(D.X);
+				Y[Lane] = static_cast<float>(D.Y);
+				Z[Lane] = static_cast<float>(D.Z);
+				R[Lane] = Radii[EntryIndex];
+			}
+			else
+			{
+				X[Lane] = Y[Lane] = Z[Lane] = R[Lane] = 0.0f;
+			}
+		}
+
+		uint32 Mask = TestBatch(X, Y, Z, R, Scores) & ((1u << Count) - 1u);
+		while (Mask != 0)
+		{
+			const int32 Lane = FMath::CountTrailingZeros(Mask);
+			Mask &= Mask - 1u;
+			OutHits[NumHits++] = { Entries[First + Lane], Scores[Lane] };
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_VRTest_ShapeQueryCandidates, Entries.Num());
+	return NumHits;
+}
@@ -0,0 +1,66 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/TimerWheel.h"
+
+FTimerWheel::FTimerWheel(float InResolution, int32 InNumSlots)
+	: Resolution(FMath::Max(InResolution, KINDA_SMALL_NUMBER))
+{
+	Slots.SetNum(FMath::Max(InNumSlots, 1));
+}
+
+void FTimerWheel::Reset(double Now)
+{
+	for (TArray<FTimerWheelEntry>& Slot : Slots)
+	{
+		Slot.Reset();
+	}
+	CurrentTick = FMath::FloorToInt64(Now / Resolution);
+	NumEntries = 0;
+}
+
+uint32 FTimerWheel::Schedule(double ExpireTime, const FObjectKey& Key, uint8 Tag)
+{
+	FTimerWheelEntry Entry;
+	Entry.Key = Key;
+	Entry.Tag = Tag;
+	Entry.Id = NextId++;
+	if (NextId == 0)
+	{
+		// 0 保留给“无定时”
+		NextId = 1;
+	}
+
+	// 已经过去的时间放到下一个刻度，保证至少在下一次 Advance 时到期
+	Entry.ExpireTick = FMath::Max(TimeToTick(ExpireTime), CurrentTick + 1);
+
+	Slots[Entry.ExpireTick % Slots.Num()].Add(Entry);
+	++NumEntries;
+	return Entry.Id;
+}
+
+void FTimerWheel::Advance(double Now, TArray<FTimerWheelEntry>& OutExpired)
+{
+	const int64 NowTick = FMath::FloorToInt64(Now / Resolution);
+	if (NowTick <= CurrentTick)
+	{
+		return;
+	}
+
+	// 跨度超过一圈时每个槽只需检查一次
+	const int64 StepCount = FMath::Min<int64>(NowTick - CurrentTick, Slots.Num());
+	for (int64 Step = 1; Step <= StepCount; ++Step)
+	{
+		TArray<FTimerWheelEntry>& Slot = Slots[(CurrentTick + Step) % Slots.Num()];
+		for (int32 Index = Slot.Num() - 1; Index >= 0; --Index)
+		{
+			if (Slot[Index].ExpireTick <= NowTick)
+			{
+				OutExpired.Add(Slot[Index]);
+				Slot.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+				--NumEntries;
+			}
+		}
+	}
+
+	CurrentTick = NowTick;
+}
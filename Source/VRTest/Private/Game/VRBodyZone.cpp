@@ -0,0 +1,32 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/VRBodyZone.h"
+
+bool FVRBodyZone::Overlaps(const FVector& LocalPoint, float Radius) const
+{
+	// 球-盒相交：球心到盒子的最近点距离 <= 半径
+	const FVector Delta = LocalPoint - Center;
+	const FVector Outside(
+		FMath::Max(FMath::Abs(Delta.X) - HalfExtent.X, 0.0f),
+		FMath::Max(FMath::Abs(Delta.Y) - HalfExtent.Y, 0.0f),
+		FMath::Max(FMath::Abs(Delta.Z) - HalfExtent.Z, 0.0f));
+	return Outside.SizeSquared() <= FMath::Square(Radius);
+}
+
+bool FVRBodyZone::AcceptsHand(bool bIsRightHand) const
+{
+	switch (Hand)
+	{
+	case EControllerHand::Left:
+		return !bIsRightHand;
+	case EControllerHand::Right:
+		return bIsRightHand;
+	default:
+		return true;
+	}
+}
+
+FTransform VRBodyZone::MakeBodyFrame(const FVector& HeadLocation, const FRotator& HeadRotation)
+{
+	return FTransform(FRotator(0.0f, HeadRotation.Yaw, 0.0f), HeadLocation);
+}
@@ -0,0 +1,17 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/VRTestStats.h"
+
+DEFINE_STAT(STAT_VRTest_CustomDepthPrimitives);
+DEFINE_STAT(STAT_VRTest_ClimbSolve);
+DEFINE_STAT(STAT_VRTest_ClimbSolverIterations);
+DEFINE_STAT(STAT_VRTest_DropPlacement);
+DEFINE_STAT(STAT_VRTest_DropGroundSamples);
+DEFINE_STAT(STAT_VRTest_StasisTargetQuery);
+DEFINE_STAT(STAT_VRTest_FakePhysicsUpdate);
+DEFINE_STAT(STAT_VRTest_FakePhysicsHandles);
+DEFINE_STAT(STAT_VRTest_ShapeQuery);
+DEFINE_STAT(STAT_VRTest_ShapeQueryCandidates);
+DEFINE_STAT(STAT_VRTest_EffectResolve);
+DEFINE_STAT(STAT_VRTest_EffectsQueued);
+DEFINE_STAT(STAT_VRTest_EffectsResolved);
@@ -2,9 +2,15 @@
 
 #include "Grabbee/Arrow.h"
 #include "Grabbee/Bow.h"
+#include "Grabbee/ArrowImpactAsset.h"
+#include "Grabbee/ArrowPoolSubsystem.h"
+#include "Skill/Stasis/StasisSubsystem.h"
+#include "Effect/EffectQueueSubsystem.h"
+#include "Game/GameSettings.h"
 #include "Grabber/PlayerGrabHand.h"
 #include "Game/Characters/BaseCharacter.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/SkinnedMeshComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "NiagaraComponent.h"
 #include "Game/CollisionConfig.h"
@@ -50,6 +56,14 @@ AArrow::AArrow()
 void AArrow::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (!ImpactAsset)
+	{
+		if (const UGameSettings* Settings = UGameSettings::Get())
+		{
+			ImpactAsset = Settings->GetArrowImpactAsset();
+		}
+	}
 	
 	// 默认进入闲置状态
 	EnterIdleState();
@@ -101,9 +115,14 @@ void AArrow::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// 飞行状态：使用 LineTrace 检测碰撞
-	if (ArrowState == EArrowState::Flying && ProjectileMovement && ProjectileMovement->IsActive())
+	// 飞行状态：固定步长积分运动，渲染位置在最近两步之间插值，再用 LineTrace 检测碰撞
+	if (ArrowState == EArrowState::Flying)
 	{
+		FProjectileSimulation::Advance(FlightState, FlightParams, DeltaTime);
+
+		const float Alpha = FProjectileSimulation::GetInterpolationAlpha(FlightState, FlightParams);
+		SetActorLocationAndRotation(FProjectileSimulation::InterpolateLocation(FlightState, Alpha),
+			FProjectileSimulation::InterpolateVelocity(FlightState, Alpha).Rotation());
 		PerformFlightTrace(DeltaTime);
 	}
 }
@@ -116,6 +135,7 @@ void AArrow::EnterIdleState()
 	UnbindAttachedTarget();
 	
 	ArrowState = EArrowState::Idle;
+	MarkStateEnterTime();
 	
 	// 启用物理模拟
 	if (MeshComponent)
@@ -157,6 +177,7 @@ void AArrow::EnterNockedState(ABow* Bow)
 	}
 
 	ArrowState = EArrowState::Nocked;
+	MarkStateEnterTime();
 	NockedBow = Bow;
 
 	// 禁用物理和碰撞（由弓控制位置）
@@ -188,8 +209,9 @@ void AArrow::EnterFlyingState(float LaunchSpeed)
 	}
 	
 	ArrowState = EArrowState::Flying;
+	MarkStateEnterTime();
 
-	// 禁用物理模拟（由 ProjectileMovement 控制）
+	// 禁用物理模拟（由飞行模拟控制）
 	if (MeshComponent)
 	{
 		MeshComponent->SetSimulatePhysics(false);
@@ -199,25 +221,12 @@ void AArrow::EnterFlyingState(float LaunchSpeed)
 	}
 
 
-	// 启用投射物移动
-	if (ProjectileMovement)
-	{
-		// 1. 先设置 UpdatedComponent
-		ProjectileMovement->SetUpdatedComponent(MeshComponent);
-		
-		// 2. 配置参数
-		ProjectileMovement->InitialSpeed = LaunchSpeed;
-		ProjectileMovement->MaxSpeed = LaunchSpeed * 2.0f;
-		ProjectileMovement->bRotationFollowsVelocity = true;
-		ProjectileMovement->ProjectileGravityScale = 1.0f;
-		
-		// 3. 激活组件
-		ProjectileMovement->Activate(true);
-		ProjectileMovement->SetComponentTickEnabled(true);
-		
-		// 4. 最后设置速度（使用 SetVelocityInLocalSpace 强制设置）
-		ProjectileMovement->SetVelocityInLocalSpace(FVector(LaunchSpeed, 0, 0));
-	}
+	SetActorTickEnabled(true);
+
+	// 初始化飞行模拟（沿箭的朝向发射，参数与弓的轨迹预览一致）
+	FlightParams = MakeFlightSimParams(LaunchSpeed);
+	FlightState = FProjectileSimState(GetActorLocation(), GetActorForwardVector() * LaunchSpeed);
+	RicochetCount = 0;
 
 	// 启用轨迹效果
 	if (TrailEffect)
@@ -236,6 +245,7 @@ void AArrow::EnterFlyingState(float LaunchSpeed)
 void AArrow::EnterStuckState(USceneComponent* HitComponent, FName BoneName)
 {
 	ArrowState = EArrowState::Stuck;
+	MarkStateEnterTime();
 
 	// 停止投射物移动
 	if (ProjectileMovement)
@@ -264,11 +274,119 @@ void AArrow::EnterStuckState(USceneComponent* HitComponent, FName BoneName)
 
 		// 绑定目标 Actor EndPlay：目标消失时让箭恢复 Idle
 		BindAttachedTarget(HitComponent->GetOwner());
+
+		// 插在静态场景上的箭交给对象池，稍后转成实例化网格
+		if (UArrowPoolSubsystem* Pool = UArrowPoolSubsystem::Get(this))
+		{
+			Pool->NotifyArrowStuck(this, HitComponent);
+		}
 	}
 
+	// Tick 只在飞行时有用，插住后关闭
+	SetActorTickEnabled(false);
+
 	bCanGrab = true;
 }
 
+void AArrow::EnterPooledState()
+{
+	// 池化前解除与旧目标/弓的一切关联
+	UnbindAttachedTarget();
+	if (GetAttachParentActor())
+	{
+		DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	}
+
+	ArrowState = EArrowState::Pooled;
+	MarkStateEnterTime();
+
+	if (MeshComponent)
+	{
+		MeshComponent->SetSimulatePhysics(false);
+		MeshComponent->SetCollisionProfileName(CP_NO_COLLISION);
+	}
+
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->SetActive(false);
+	}
+
+	if (TrailEffect)
+	{
+		TrailEffect->DeactivateImmediate();
+	}
+
+	Extinguish();
+	if (FireNiagaraEffect)
+	{
+		FireNiagaraEffect->DeactivateImmediate();
+	}
+
+	bHasHit = false;
+	HitBoneName = NAME_None;
+	NockedBow = nullptr;
+	OwningCharacter = nullptr;
+	FlightState = FProjectileSimState();
+	bCanGrab = false;
+	ClearGrabSelection();
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+}
+
+void AArrow::ResetForReuse(const FTransform& SpawnTransform)
+{
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+
+	// 重置投射物组件：StopMovementImmediately 会清空速度，重新绑定 UpdatedComponent 以防被 StopSimulating 清掉
+	if (ProjectileMovement)
+	{
+		ProjectileMovement->StopMovementImmediately();
+		ProjectileMovement->SetUpdatedComponent(MeshComponent);
+		ProjectileMovement->SetActive(false);
+	}
+
+	// 重置 Niagara：立即清掉上一次飞行残留的粒子（下次 EnterFlyingState 再激活）
+	if (TrailEffect)
+	{
+		TrailEffect->DeactivateImmediate();
+	}
+	if (FireNiagaraEffect)
+	{
+		FireNiagaraEffect->DeactivateImmediate();
+		FireNiagaraEffect->SetVisibility(false);
+	}
+
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+	if (MeshComponent)
+	{
+		MeshComponent->SetPhysicsLinearVelocity(FVector::ZeroVector);
+		MeshComponent->SetPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+	}
+
+	EnterIdleState();
+}
+
+FProjectileSimParams AArrow::MakeFlightSimParams(float LaunchSpeed) const
+{
+	FProjectileSimParams Params;
+	const UWorld* World = GetWorld();
+	Params.GravityZ = (World ? World->GetGravityZ() : 0.0f) * FlightGravityScale;
+	Params.LinearDrag = FlightLinearDrag;
+	Params.MaxSpeed = LaunchSpeed * 2.0f;
+	return Params;
+}
+
+void AArrow::MarkStateEnterTime()
+{
+	const UWorld* World = GetWorld();
+	StateEnterTime = World ? World->GetTimeSeconds() : 0.0f;
+}
+
 // ==================== 火焰效果 ====================
 
 void AArrow::CatchFire()
@@ -355,6 +473,8 @@ void AArrow::PerformFlightTrace(float DeltaTime)
 	FHitResult HitResult;
 	FCollisionQueryParams QueryParams;
 	QueryParams.AddIgnoredActor(this);
+	// 命中模型按物理材质查表，随本次 Trace 一起返回，无需额外查询
+	QueryParams.bReturnPhysicalMaterial = ImpactAsset != nullptr;
 	
 	// 忽略发射者（玩家）
 	if (OwningCharacter)
@@ -377,6 +497,9 @@ void AArrow::PerformFlightTrace(float DeltaTime)
 		QueryParams
 	);
 
+	// 更新上一帧位置（先于 HandleHit：弹飞时会改写为弹飞后的箭头位置）
+	PreviousTipLocation = CurrentTipLocation;
+
 	if (bHit && HitResult.GetActor())
 	{
 		// 忽略弓
@@ -385,9 +508,6 @@ void AArrow::PerformFlightTrace(float DeltaTime)
 			HandleHit(HitResult);
 		}
 	}
-
-	// 更新上一帧位置
-	PreviousTipLocation = CurrentTipLocation;
 }
 
 void AArrow::HandleHit(const FHitResult& HitResult)
@@ -397,47 +517,104 @@ void AArrow::HandleHit(const FHitResult& HitResult)
 		return;
 	}
 
-	bHasHit = true;
-
 	AActor* HitActor = HitResult.GetActor();
 	UPrimitiveComponent* HitComp = HitResult.GetComponent();
 
 	// 获取命中骨骼名称（如果是骨骼网格体）
 	FName BoneName = HitResult.BoneName;
 
+	// 按命中模型评估：未配置时保持旧行为（直接插入，伤害不变）
+	FArrowImpactResult Impact;
+	if (ImpactAsset)
+	{
+		ImpactAsset->EvaluateImpact(HitResult.PhysMaterial.Get(), HitResult.ImpactNormal, FlightState.Velocity, RicochetCount, Impact);
+		if (Impact.DamageMultiplier > 0.0f && !BoneName.IsNone())
+		{
+			Impact.DamageMultiplier *= ImpactAsset->GetBoneDamageMultiplier(Cast<USkinnedMeshComponent>(HitComp), BoneName);
+		}
+	}
+
+	if (Impact.Outcome == EArrowImpactOutcome::Ricochet)
+	{
+		HandleRicochet(HitResult, Impact.OutVelocity);
+		return;
+	}
+
+	bHasHit = true;
+
 	// 准备物理冲量数据
 	FVector ImpulseDir = FVector::ZeroVector;
 	float ImpulseStrength = 0.0f;
 	bool bShouldApplyImpulse = false;
 
-	if (HitComp && HitComp->IsSimulatingPhysics())
+	// 定身中的目标已转为运动学，但冲量仍要计算（存起来，解除定身时释放）
+	UStasisSubsystem* Stasis = UStasisSubsystem::Get(this);
+	const bool bHitInStasis = Stasis && HitComp && Stasis->IsFrozen(HitComp->GetOwner());
+
+	if (HitComp && (HitComp->IsSimulatingPhysics() || bHitInStasis))
 	{
 		bShouldApplyImpulse = true;
 		ImpulseDir = GetActorForwardVector();
 		
-		if (ProjectileMovement && ProjectileMovement->Velocity.SizeSquared() > 1.0f)
+		if (FlightState.Velocity.SizeSquared() > 1.0f)
 		{
-			ImpulseDir = ProjectileMovement->Velocity.GetSafeNormal();
+			ImpulseDir = FlightState.Velocity.GetSafeNormal();
 			// 动量 = 质量 * 速度，这里简单模拟
-			ImpulseStrength = ProjectileMovement->Velocity.Size() * ImpulseStrengthMultiplier; 
+			ImpulseStrength = FlightState.Velocity.Size() * ImpulseStrengthMultiplier; 
 		}
 	}
 
-	// 将箭移动到命中点（根据箭头位置组件的相对偏移）
+	// 将箭移动到命中点（根据箭头位置组件的相对偏移），再按插入深度往里推
 	float TipOffset = ArrowTipPosition ? ArrowTipPosition->GetRelativeLocation().X : 30.0f;
-	SetActorLocation(HitResult.ImpactPoint - GetActorForwardVector() * TipOffset);
+	SetActorLocation(HitResult.ImpactPoint - GetActorForwardVector() * (TipOffset - Impact.StickDepth));
 
-	// 进入插入状态
-	EnterStuckState(HitComp, BoneName);
+	if (Impact.Outcome == EArrowImpactOutcome::Drop)
+	{
+		// 插不进去：弹落成可拾取的闲置箭
+		EnterIdleState();
+		if (MeshComponent)
+		{
+			MeshComponent->SetPhysicsLinearVelocity(Impact.OutVelocity);
+		}
+	}
+	else
+	{
+		// 进入插入状态
+		EnterStuckState(HitComp, BoneName);
+	}
 
 	// 在附着后施加物理冲量，确保物体带着箭一起受到影响
 	if (bShouldApplyImpulse && HitComp)
 	{
-		HitComp->AddImpulseAtLocation(ImpulseDir * ImpulseStrength, HitResult.ImpactPoint, HitResult.BoneName);
+		if (bHitInStasis)
+		{
+			Stasis->AddStoredImpulseAtLocation(HitComp, ImpulseDir * ImpulseStrength, HitResult.ImpactPoint, HitResult.BoneName);
+		}
+		else
+		{
+			HitComp->AddImpulseAtLocation(ImpulseDir * ImpulseStrength, HitResult.ImpactPoint, HitResult.BoneName);
+		}
 	}
 	
 	// 造成伤害
-	DealDamage(HitActor);
+	if (Impact.DamageMultiplier > 0.0f)
+	{
+		DealDamage(HitActor, Impact.DamageMultiplier);
+	}
+}
+
+void AArrow::HandleRicochet(const FHitResult& HitResult, const FVector& NewVelocity)
+{
+	++RicochetCount;
+
+	// 从命中点沿法线稍微离开表面，避免下一帧再次命中同一表面
+	const float TipOffset = ArrowTipPosition ? ArrowTipPosition->GetRelativeLocation().X : 30.0f;
+	const FVector NewTipLocation = HitResult.ImpactPoint + HitResult.ImpactNormal * 1.0f;
+	const FRotator NewRotation = NewVelocity.SizeSquared() > 1.0f ? NewVelocity.Rotation() : GetActorRotation();
+	SetActorLocationAndRotation(NewTipLocation - NewRotation.Vector() * TipOffset, NewRotation);
+
+	FlightState.SetCurrent(GetActorLocation(), NewVelocity);
+	PreviousTipLocation = NewTipLocation;
 }
 
 // ==================== IEffectable 接口 ====================
@@ -458,7 +635,7 @@ void AArrow::ApplyEffect_Implementation(const FEffect& Effect)
 // ==================== 内部函数 ====================
 
 
-void AArrow::DealDamage(AActor* HitActor)
+void AArrow::DealDamage(AActor* HitActor, float DamageScale)
 {
 	if (!HitActor)
 	{
@@ -470,7 +647,7 @@ void AArrow::DealDamage(AActor* HitActor)
 	{
 		FEffect Effect;
 		Effect.EffectTypes.Add(EEffectType::Arrow);
-		Effect.Amount = ArrowDamage;
+		Effect.Amount = ArrowDamage * DamageScale;
 		Effect.Causer = this;
 		Effect.Instigator = OwningCharacter;
 		Effect.Duration = 0.f;
@@ -481,6 +658,7 @@ void AArrow::DealDamage(AActor* HitActor)
 			Effect.Duration = FireEffectTime;
 		}
 
-		IEffectable::Execute_ApplyEffect(HitActor, Effect);
+		// 角色目标入队，同一帧的多次命中合并结算
+		UEffectQueueSubsystem::ApplyEffect(HitActor, Effect);
 	}
 }
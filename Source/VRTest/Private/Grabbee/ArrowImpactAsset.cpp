@@ -0,0 +1,123 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabbee/ArrowImpactAsset.h"
+#include "Components/SkinnedMeshComponent.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+
+void UArrowImpactAsset::PostLoad()
+{
+	Super::PostLoad();
+	RebuildImpactCache();
+}
+
+#if WITH_EDITOR
+void UArrowImpactAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// 参数都很少，任意修改都整体重建
+	RebuildImpactCache();
+}
+#endif
+
+void UArrowImpactAsset::EvaluateImpact(const UPhysicalMaterial* PhysMaterial, const FVector& ImpactNormal, const FVector& Velocity,
+	int32 RicochetCount, FArrowImpactResult& OutResult) const
+{
+	const FCachedProfile* Cached = PhysMaterial ? CachedProfiles.Find(PhysMaterial) : nullptr;
+	if (!Cached)
+	{
+		Cached = &CachedDefaultProfile;
+	}
+	const FArrowImpactProfile& Profile = Cached->Profile;
+
+	OutResult = FArrowImpactResult();
+	OutResult.DamageMultiplier = Profile.DamageMultiplier;
+
+	// 法向速度（指向表面内部为正）；Speed * sin(掠射角) = NormalSpeed，用乘法比较避免开方和三角函数
+	const float NormalSpeed = -FVector::DotProduct(Velocity, ImpactNormal);
+	const float SpeedSquared = Velocity.SizeSquared();
+	const FVector Reflected = Velocity + ImpactNormal * (2.0f * NormalSpeed);
+
+	const bool bGrazing = NormalSpeed <= 0.0f ||
+		FMath::Square(NormalSpeed) < FMath::Square(Cached->RicochetSinThreshold) * SpeedSquared;
+	if (bGrazing && RicochetCount < MaxRicochets)
+	{
+		OutResult.Outcome = EArrowImpactOutcome::Ricochet;
+		OutResult.OutVelocity = Reflected * Profile.RicochetSpeedRetention;
+		OutResult.DamageMultiplier = 0.0f;
+		return;
+	}
+
+	if (!Profile.bCanStick || NormalSpeed < Profile.MinStickSpeed)
+	{
+		OutResult.Outcome = EArrowImpactOutcome::Drop;
+		OutResult.OutVelocity = Reflected * Profile.RicochetSpeedRetention;
+		return;
+	}
+
+	OutResult.Outcome = EArrowImpactOutcome::Stick;
+	OutResult.StickDepth = FMath::Min(NormalSpeed * Cached->DepthPerSpeed, Profile.MaxPenetrationDepth);
+}
+
+float UArrowImpactAsset::GetBoneDamageMultiplier(const USkinnedMeshComponent* SkinnedMesh, FName BoneName) const
+{
+	if (BoneName.IsNone())
+	{
+		return DefaultBoneDamageMultiplier;
+	}
+
+	const TPair<FObjectKey, FName> CacheKey(FObjectKey(SkinnedMesh ? SkinnedMesh->GetSkinnedAsset() : nullptr), BoneName);
+	if (const float* Resolved = ResolvedBoneMultipliers.Find(CacheKey))
+	{
+		return *Resolved;
+	}
+
+	// 沿父骨骼向上找最近的已配置骨骼
+	float Multiplier = DefaultBoneDamageMultiplier;
+	FName CurrentBone = BoneName;
+	while (!CurrentBone.IsNone())
+	{
+		if (const float* Found = BoneDamageMultipliers.Find(CurrentBone))
+		{
+			Multiplier = *Found;
+			break;
+		}
+		CurrentBone = SkinnedMesh ? SkinnedMesh->GetParentBone(CurrentBone) : NAME_None;
+	}
+
+	// 没有骨骼层级信息时结果不可靠，不缓存
+	if (SkinnedMesh && SkinnedMesh->GetSkinnedAsset())
+	{
+		ResolvedBoneMultipliers.Add(CacheKey, Multiplier);
+	}
+	return Multiplier;
+}
+
+// ==================== 内部函数 ====================
+
+UArrowImpactAsset::FCachedProfile UArrowImpactAsset::MakeCachedProfile(const FArrowImpactProfile& Profile)
+{
+	FCachedProfile Cached;
+	Cached.Profile = Profile;
+	Cached.RicochetSinThreshold = FMath::Sin(FMath::DegreesToRadians(FMath::Clamp(Profile.RicochetAngle, 0.0f, 90.0f)));
+	Cached.DepthPerSpeed = Profile.PenetrationPer1000Speed / 1000.0f;
+	return Cached;
+}
+
+void UArrowImpactAsset::RebuildImpactCache()
+{
+	CachedDefaultProfile = MakeCachedProfile(DefaultProfile);
+
+	CachedProfiles.Empty(MaterialProfiles.Num());
+	for (const TPair<TObjectPtr<UPhysicalMaterial>, FArrowImpactProfile>& Pair : MaterialProfiles)
+	{
+		if (!Pair.Key)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ArrowImpactAsset[%s]: MaterialProfiles has an empty physical material key, ignored."), *GetName());
+			continue;
+		}
+		CachedProfiles.Add(Pair.Key, MakeCachedProfile(Pair.Value));
+	}
+
+	ResolvedBoneMultipliers.Reset();
+}
@@ -0,0 +1,390 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabbee/ArrowPoolSubsystem.h"
+#include "Grabbee/Arrow.h"
+#include "Game/GameSettings.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/StaticMesh.h"
+#include "TimerManager.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Pawn.h"
+
+UArrowPoolSubsystem* UArrowPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UArrowPoolSubsystem>() : nullptr;
+}
+
+void UArrowPoolSubsystem::ReturnToPoolOrDestroy(AActor* ArrowActor)
+{
+	if (!ArrowActor)
+	{
+		return;
+	}
+
+	AArrow* Arrow = Cast<AArrow>(ArrowActor);
+	UArrowPoolSubsystem* Pool = Get(ArrowActor);
+	if (Arrow && Pool)
+	{
+		Pool->ReleaseArrow(Arrow);
+		return;
+	}
+
+	ArrowActor->Destroy();
+}
+
+bool UArrowPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UArrowPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	int32 PrewarmCount = 0;
+	if (const UGameSettings* Settings = UGameSettings::Get())
+	{
+		ArrowClass = Settings->GetArrowClass();
+		PrewarmCount = Settings->ArrowPoolPrewarmCount;
+		MaxArrowCount = FMath::Max(1, Settings->ArrowPoolMaxCount);
+		RecycleAgeWeight = Settings->ArrowRecycleAgeWeight;
+		RecycleDistanceWeight = Settings->ArrowRecycleDistanceWeight;
+		bInstanceStuckArrows = Settings->bInstanceStuckArrows;
+		StuckArrowInstanceDelay = Settings->StuckArrowInstanceDelay;
+		StuckArrowInstanceBudget = FMath::Max(1, Settings->StuckArrowInstanceBudget);
+	}
+
+	Prewarm(PrewarmCount);
+
+	if (bInstanceStuckArrows)
+	{
+		InWorld.GetTimerManager().SetTimer(StuckArrowTimerHandle, this,
+			&UArrowPoolSubsystem::ProcessPendingStuckArrows, StuckArrowCheckInterval, true);
+	}
+}
+
+void UArrowPoolSubsystem::Deinitialize()
+{
+	UE_LOG(LogTemp, Log, TEXT("ArrowPool: hits=%d misses=%d recycles=%d instanced=%d evicted=%d (free=%d live=%d)"),
+		HitCount, MissCount, RecycleCount, InstancedCount, InstanceEvictCount, FreeArrows.Num(), LiveArrows.Num());
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(StuckArrowTimerHandle);
+	}
+
+	FreeArrows.Reset();
+	LiveArrows.Reset();
+	PendingStuckArrows.Reset();
+	InstanceBatches.Reset();
+	InstanceHolder = nullptr;
+	ArrowClass = nullptr;
+
+	Super::Deinitialize();
+}
+
+// ==================== 取/还 ====================
+
+AArrow* UArrowPoolSubsystem::AcquireArrow(const FTransform& SpawnTransform, AActor* NewOwner, APawn* NewInstigator)
+{
+	PruneInvalidArrows();
+
+	AArrow* Arrow = nullptr;
+
+	if (FreeArrows.Num() > 0)
+	{
+		Arrow = FreeArrows.Pop(EAllowShrinking::No);
+		++HitCount;
+	}
+	else if (FreeArrows.Num() + LiveArrows.Num() < MaxArrowCount)
+	{
+		Arrow = SpawnPooledArrow();
+		++MissCount;
+	}
+	else
+	{
+		// 已达上限：回收场景中最旧/离得最远的 Stuck/Idle 箭
+		Arrow = FindRecycleCandidate(SpawnTransform.GetLocation());
+		if (Arrow)
+		{
+			LiveArrows.RemoveSingleSwap(Arrow, EAllowShrinking::No);
+			Arrow->EnterPooledState();
+			++RecycleCount;
+		}
+		else
+		{
+			// 场景中的箭全部在手上/弓上/飞行中：宁可超出上限也不让取箭失败
+			Arrow = SpawnPooledArrow();
+			++MissCount;
+		}
+	}
+
+	if (!Arrow)
+	{
+		return nullptr;
+	}
+
+	Arrow->SetOwner(NewOwner);
+	Arrow->SetInstigator(NewInstigator);
+	Arrow->ResetForReuse(SpawnTransform);
+	LiveArrows.Add(Arrow);
+	return Arrow;
+}
+
+void UArrowPoolSubsystem::ReleaseArrow(AArrow* Arrow)
+{
+	if (!IsValid(Arrow) || Arrow->ArrowState == EArrowState::Pooled)
+	{
+		return;
+	}
+
+	const bool bWasTracked = LiveArrows.RemoveSingleSwap(Arrow, EAllowShrinking::No) > 0;
+
+	// 关卡里直接摆放的箭不归池子管：池子未满时收编，否则直接销毁
+	if (!bWasTracked && FreeArrows.Num() + LiveArrows.Num() >= MaxArrowCount)
+	{
+		Arrow->Destroy();
+		return;
+	}
+
+	Arrow->EnterPooledState();
+	FreeArrows.Add(Arrow);
+}
+
+void UArrowPoolSubsystem::Prewarm(int32 Count)
+{
+	const int32 Target = FMath::Min(Count, MaxArrowCount - LiveArrows.Num());
+	while (FreeArrows.Num() < Target)
+	{
+		AArrow* Arrow = SpawnPooledArrow();
+		if (!Arrow)
+		{
+			break;
+		}
+		FreeArrows.Add(Arrow);
+	}
+}
+
+// ==================== 插入箭实例化 ====================
+
+void UArrowPoolSubsystem::NotifyArrowStuck(AArrow* Arrow, const USceneComponent* HitComponent)
+{
+	if (!bInstanceStuckArrows || !IsValid(Arrow) || !HitComponent)
+	{
+		return;
+	}
+
+	// 只处理静态/固定组件；插在会动的东西上的箭要跟着动，保持为 Actor
+	if (HitComponent->Mobility == EComponentMobility::Movable)
+	{
+		return;
+	}
+
+	PendingStuckArrows.AddUnique(Arrow);
+}
+
+void UArrowPoolSubsystem::ClearInstancedArrows()
+{
+	for (TPair<TObjectPtr<UStaticMesh>, FStuckArrowInstanceBatch>& Pair : InstanceBatches)
+	{
+		if (Pair.Value.Component)
+		{
+			Pair.Value.Component->ClearInstances();
+		}
+		Pair.Value.NextSlot = 0;
+	}
+}
+
+void UArrowPoolSubsystem::ProcessPendingStuckArrows()
+{
+	const UWorld* World = GetWorld();
+	if (!World || PendingStuckArrows.Num() == 0)
+	{
+		return;
+	}
+
+	const float Now = World->GetTimeSeconds();
+	for (int32 Index = PendingStuckArrows.Num() - 1; Index >= 0; --Index)
+	{
+		AArrow* Arrow = PendingStuckArrows[Index];
+
+		// 已被拔出/回收/销毁：不再等待
+		if (!IsValid(Arrow) || Arrow->ArrowState != EArrowState::Stuck)
+		{
+			PendingStuckArrows.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// 正在被选中/抓住、还在燃烧、或者刚插上：下次再看
+		if (Arrow->bIsHeld || Arrow->bIsSelected || Arrow->bOnFire ||
+			Now - Arrow->GetStateEnterTime() < StuckArrowInstanceDelay)
+		{
+			continue;
+		}
+
+		PendingStuckArrows.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		ConvertArrowToInstance(Arrow);
+	}
+}
+
+bool UArrowPoolSubsystem::ConvertArrowToInstance(AArrow* Arrow)
+{
+	UStaticMeshComponent* ArrowMesh = Arrow ? Arrow->MeshComponent : nullptr;
+	UStaticMesh* Mesh = ArrowMesh ? ArrowMesh->GetStaticMesh() : nullptr;
+	if (!Mesh)
+	{
+		return false;
+	}
+
+	FStuckArrowInstanceBatch* Batch = FindOrCreateInstanceBatch(Mesh, Arrow);
+	if (!Batch || !Batch->Component)
+	{
+		return false;
+	}
+
+	const FTransform InstanceTransform = ArrowMesh->GetComponentTransform();
+	UInstancedStaticMeshComponent* ISM = Batch->Component;
+	if (ISM->GetInstanceCount() < StuckArrowInstanceBudget)
+	{
+		ISM->AddInstance(InstanceTransform, true);
+	}
+	else
+	{
+		// 预算已满：覆盖最早的实例，不增删实例，下标保持稳定
+		ISM->UpdateInstanceTransform(Batch->NextSlot, InstanceTransform, true, true, true);
+		Batch->NextSlot = (Batch->NextSlot + 1) % StuckArrowInstanceBudget;
+		++InstanceEvictCount;
+	}
+	++InstancedCount;
+
+	ReleaseArrow(Arrow);
+	return true;
+}
+
+FStuckArrowInstanceBatch* UArrowPoolSubsystem::FindOrCreateInstanceBatch(UStaticMesh* Mesh, const AArrow* SourceArrow)
+{
+	if (FStuckArrowInstanceBatch* Existing = InstanceBatches.Find(Mesh))
+	{
+		return Existing;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (!InstanceHolder)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		InstanceHolder = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+		if (!InstanceHolder)
+		{
+			return nullptr;
+		}
+
+		USceneComponent* Root = NewObject<USceneComponent>(InstanceHolder, TEXT("Root"));
+		InstanceHolder->SetRootComponent(Root);
+		Root->RegisterComponent();
+	}
+
+	UInstancedStaticMeshComponent* ISM = NewObject<UInstancedStaticMeshComponent>(InstanceHolder);
+	ISM->SetStaticMesh(Mesh);
+	ISM->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ISM->SetGenerateOverlapEvents(false);
+	ISM->SetupAttachment(InstanceHolder->GetRootComponent());
+
+	// 沿用箭上的材质覆盖
+	if (const UStaticMeshComponent* SourceMesh = SourceArrow ? SourceArrow->MeshComponent : nullptr)
+	{
+		for (int32 MaterialIndex = 0; MaterialIndex < SourceMesh->GetNumMaterials(); ++MaterialIndex)
+		{
+			ISM->SetMaterial(MaterialIndex, SourceMesh->GetMaterial(MaterialIndex));
+		}
+	}
+
+	ISM->RegisterComponent();
+	InstanceHolder->AddInstanceComponent(ISM);
+
+	FStuckArrowInstanceBatch& Batch = InstanceBatches.Add(Mesh);
+	Batch.Component = ISM;
+	return &Batch;
+}
+
+// ==================== 内部函数 ====================
+
+AArrow* UArrowPoolSubsystem::SpawnPooledArrow()
+{
+	UWorld* World = GetWorld();
+	if (!World || !ArrowClass)
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	AArrow* Arrow = World->SpawnActor<AArrow>(ArrowClass, FTransform::Identity, SpawnParams);
+	if (Arrow)
+	{
+		Arrow->EnterPooledState();
+	}
+	return Arrow;
+}
+
+AArrow* UArrowPoolSubsystem::FindRecycleCandidate(const FVector& RequestLocation) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	const float Now = World->GetTimeSeconds();
+	AArrow* BestArrow = nullptr;
+	float BestScore = -FLT_MAX;
+
+	for (AArrow* Arrow : LiveArrows)
+	{
+		if (!IsValid(Arrow))
+		{
+			continue;
+		}
+
+		// 只回收插在目标上或躺在地上的箭；手上、弓上、飞行中、被重力手套选中的不动
+		if (Arrow->ArrowState != EArrowState::Stuck && Arrow->ArrowState != EArrowState::Idle)
+		{
+			continue;
+		}
+		if (Arrow->bIsHeld || Arrow->bIsSelected)
+		{
+			continue;
+		}
+
+		const float Age = Now - Arrow->GetStateEnterTime();
+		const float DistanceMeters = FVector::Dist(RequestLocation, Arrow->GetActorLocation()) * 0.01f;
+		const float Score = Age * RecycleAgeWeight + DistanceMeters * RecycleDistanceWeight;
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			BestArrow = Arrow;
+		}
+	}
+
+	return BestArrow;
+}
+
+void UArrowPoolSubsystem::PruneInvalidArrows()
+{
+	FreeArrows.RemoveAllSwap([](const TObjectPtr<AArrow>& Arrow) { return !IsValid(Arrow); }, EAllowShrinking::No);
+	LiveArrows.RemoveAllSwap([](const TObjectPtr<AArrow>& Arrow) { return !IsValid(Arrow); }, EAllowShrinking::No);
+}
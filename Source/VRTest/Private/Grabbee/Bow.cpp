@@ -179,33 +179,149 @@ void ABow::UpdateArrowTracePreview()
 	float Speed = CalculateFiringSpeed();
 	FVector LaunchVelocity = LaunchDirection * Speed;
 
-	// 预测轨迹
-	FPredictProjectilePathParams PathParams;
-	PathParams.StartLocation = CurrentGrabSpot;
-	PathParams.LaunchVelocity = LaunchVelocity;
-	PathParams.ProjectileRadius = 2.0f;
-	PathParams.MaxSimTime = 3.0f;
-	PathParams.bTraceWithCollision = true;
-	PathParams.bTraceComplex = false;
-	PathParams.TraceChannel = TCC_PROJECTILE;
-	PathParams.ActorsToIgnore.Add(this);
-	PathParams.ActorsToIgnore.Add(BowOwner);
-	if (NockedArrow)
+	const UWorld* World = GetWorld();
+	const float Now = World ? World->GetTimeSeconds() : 0.0f;
+
+	// 发射参数变化超过阈值（且距上次查询超过最短间隔），或长时间未刷新，才重新做碰撞查询
+	bool bNeedQuery = true;
+	if (bUseCachedTracePreview)
 	{
-		PathParams.ActorsToIgnore.Add(NockedArrow);
+		const bool bLaunchChanged =
+			FVector::DistSquared(LaunchVelocity, LastQueryVelocity) > FMath::Square(TracePreviewVelocityThreshold) ||
+			FVector::DistSquared(CurrentGrabSpot, LastQueryStart) > FMath::Square(TracePreviewLocationThreshold);
+		const float SinceLastQuery = Now - LastQueryTime;
+		bNeedQuery = bTracePreviewDirty || LastQueryTime < 0.0f ||
+			(bLaunchChanged && SinceLastQuery >= TracePreviewMinQueryInterval) ||
+			SinceLastQuery >= TracePreviewMaxQueryInterval;
 	}
 
-	FPredictProjectilePathResult PathResult;
-	UGameplayStatics::PredictProjectilePath(this, PathParams, PathResult);
+	// 量化后的发射参数与缓存的轨迹相同且无需重新查询时，不做任何事
+	const FIntVector StartKey(
+		FMath::RoundToInt(CurrentGrabSpot.X / TracePreviewLocationQuantum),
+		FMath::RoundToInt(CurrentGrabSpot.Y / TracePreviewLocationQuantum),
+		FMath::RoundToInt(CurrentGrabSpot.Z / TracePreviewLocationQuantum));
+	const FIntVector VelocityKey(
+		FMath::RoundToInt(LaunchVelocity.X / TracePreviewVelocityQuantum),
+		FMath::RoundToInt(LaunchVelocity.Y / TracePreviewVelocityQuantum),
+		FMath::RoundToInt(LaunchVelocity.Z / TracePreviewVelocityQuantum));
+	const bool bLaunchMoved = bTracePreviewDirty || StartKey != CachedPathStartKey || VelocityKey != CachedPathVelocityKey;
+	if (!bLaunchMoved && !bNeedQuery)
+	{
+		return;
+	}
+
+	const FProjectileSimParams SimParams = NockedArrow->MakeFlightSimParams(Speed);
+	const int32 StepsPerSample = FMath::Max(1, FMath::RoundToInt(TracePreviewTimeStep / SimParams.FixedTimeStep));
+	const float SampleInterval = StepsPerSample * SimParams.FixedTimeStep;
+	if (bLaunchMoved)
+	{
+		BuildTracePreviewPath(CurrentGrabSpot, LaunchVelocity, SimParams, StepsPerSample);
+		CachedPathStartKey = StartKey;
+		CachedPathVelocityKey = VelocityKey;
+	}
+
+	if (bNeedQuery)
+	{
+		CachedTraceHitTime = QueryTracePreviewHitTime(SampleInterval);
+		LastQueryStart = CurrentGrabSpot;
+		LastQueryVelocity = LaunchVelocity;
+		LastQueryTime = Now;
+	}
+
+	const float EndTime = CachedTraceHitTime;
+	if (!bLaunchMoved && FMath::IsNearlyEqual(EndTime, LastPushedEndTime, KINDA_SMALL_NUMBER))
+	{
+		// 重新查询后命中点没变，Niagara 数组无需更新
+		return;
+	}
+
+	TracePreviewPoints.Reset();
+	TracePreviewPoints.Append(TracePreviewPathPoints);
+	TruncateTracePreviewPoints(SampleInterval, EndTime);
 
 	// 将轨迹点传递给 Niagara
-	TArray<FVector> PathPoints;
-	for (const FPredictProjectilePathPointData& PointData : PathResult.PathData)
+	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(ArrowTracePreview, FName("User.PointArray"), TracePreviewPoints);
+
+	LastPushedEndTime = EndTime;
+	bTracePreviewDirty = false;
+}
+
+void ABow::InvalidateTracePreview()
+{
+	bTracePreviewDirty = true;
+	LastQueryTime = -1.0f;
+}
+
+void ABow::BuildTracePreviewPath(const FVector& Start, const FVector& LaunchVelocity, const FProjectileSimParams& SimParams, int32 StepsPerSample)
+{
+	const float Dt = SimParams.FixedTimeStep;
+	const int32 NumSamples = FMath::CeilToInt(TracePreviewMaxSimTime / Dt) / StepsPerSample;
+
+	// 速度上限：|V0| + |g| * T 都达不到时不会触发
+	const bool bSpeedClampInactive = SimParams.MaxSpeed <= 0.0f ||
+		LaunchVelocity.Size() + FMath::Abs(SimParams.GravityZ) * TracePreviewMaxSimTime <= SimParams.MaxSpeed;
+	if (SimParams.bHoming || SimParams.LinearDrag != 0.0f || !bSpeedClampInactive)
+	{
+		FProjectileSimulation::PredictPath(FProjectileSimState(Start, LaunchVelocity), SimParams,
+			TracePreviewMaxSimTime, StepsPerSample, TracePreviewPathPoints);
+		return;
+	}
+
+	// 半隐式欧拉 n 步后：V_n = V0 + n*g*dt，P_n = P0 + n*dt*V0 + g*dt²*n(n+1)/2（与逐步积分完全一致）
+	const FVector GravityDtSq(0.0f, 0.0f, SimParams.GravityZ * Dt * Dt);
+	TracePreviewPathPoints.SetNumUninitialized(NumSamples + 1, EAllowShrinking::No);
+	for (int32 Sample = 0; Sample <= NumSamples; ++Sample)
 	{
-		PathPoints.Add(PointData.Location);
+		const float N = static_cast<float>(Sample * StepsPerSample);
+		TracePreviewPathPoints[Sample] = Start + LaunchVelocity * (N * Dt) + GravityDtSq * (N * (N + 1.0f) * 0.5f);
+	}
+}
+
+float ABow::QueryTracePreviewHitTime(float SampleInterval) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return TracePreviewMaxSimTime;
+	}
+
+	// 与箭飞行时的 PerformFlightTrace 使用相同的通道
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(BowTracePreview), false);
+	QueryParams.AddIgnoredActor(this);
+	QueryParams.AddIgnoredActor(BowOwner);
+	QueryParams.AddIgnoredActor(NockedArrow);
+
+	FHitResult Hit;
+	for (int32 Index = 1; Index < TracePreviewPathPoints.Num(); ++Index)
+	{
+		if (World->LineTraceSingleByChannel(Hit, TracePreviewPathPoints[Index - 1], TracePreviewPathPoints[Index], TCC_PROJECTILE, QueryParams))
+		{
+			return FMath::Min((Index - 1 + Hit.Time) * SampleInterval, TracePreviewMaxSimTime);
+		}
+	}
+
+	return TracePreviewMaxSimTime;
+}
+
+void ABow::TruncateTracePreviewPoints(float SampleInterval, float EndTime)
+{
+	if (TracePreviewPoints.Num() < 2 || SampleInterval <= 0.0f)
+	{
+		return;
+	}
+
+	const float SegmentPosition = EndTime / SampleInterval;
+	const int32 SegmentIndex = FMath::FloorToInt(SegmentPosition);
+	if (SegmentIndex >= TracePreviewPoints.Num() - 1)
+	{
+		return;
 	}
 
-	UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(ArrowTracePreview, FName("User.PointArray"), PathPoints);
+	// 末点插值到命中位置，丢掉之后的点（不释放内存）
+	const float Alpha = SegmentPosition - SegmentIndex;
+	const FVector EndPoint = FMath::Lerp(TracePreviewPoints[SegmentIndex], TracePreviewPoints[SegmentIndex + 1], Alpha);
+	TracePreviewPoints.SetNum(SegmentIndex + 2, EAllowShrinking::No);
+	TracePreviewPoints[SegmentIndex + 1] = EndPoint;
 }
 
 // ==================== 重写 ====================
@@ -296,6 +412,7 @@ void ABow::OnGrabbed_Implementation(UPlayerGrabHand* Hand)
 		// 显示轨迹预览
 		if (NockedArrow && ArrowTracePreview)
 		{
+			InvalidateTracePreview();
 			ArrowTracePreview->SetVisibility(true);
 		}
 	}
@@ -8,6 +8,10 @@
 #include "Game/Characters/BaseCharacter.h"
 #include "Game/CollisionConfig.h"
 #include "Audio/AudioSubsystem.h"
+#include "Grabber/GrabbableRegistrySubsystem.h"
+#include "Skill/Stasis/StasisableRegistrySubsystem.h"
+#include "Skill/Stasis/StasisSubsystem.h"
+#include "Grabber/GrabHighlightSubsystem.h"
 
 AGrabbeeObject::AGrabbeeObject()
 {
@@ -22,7 +26,8 @@ AGrabbeeObject::AGrabbeeObject()
 	MeshComponent->SetCollisionProfileName(CP_GRABBABLE_PHYSICS);
 	MeshComponent->SetUseCCD(true);
 
-	MeshComponent->SetRenderCustomDepth(true);
+	// Custom Depth 只在选中时由 UGrabHighlightSubsystem 开启
+	MeshComponent->SetRenderCustomDepth(false);
 }
 
 void AGrabbeeObject::BeginPlay()
@@ -34,6 +39,17 @@ void AGrabbeeObject::BeginPlay()
 	{
 		CachedAudioSubsystem = GI->GetSubsystem<UAudioSubsystem>();
 	}
+
+	UGrabbableRegistrySubsystem::RegisterGrabbable(this);
+	UStasisableRegistrySubsystem::RegisterStasisable(this);
+}
+
+void AGrabbeeObject::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UGrabbableRegistrySubsystem::UnregisterGrabbable(this);
+	UStasisableRegistrySubsystem::UnregisterStasisable(this);
+	ClearGrabSelection();
+	Super::EndPlay(EndPlayReason);
 }
 
 // ==================== IGrabbable 接口实现 ====================
@@ -124,11 +140,8 @@ void AGrabbeeObject::OnGrabbed_Implementation(UPlayerGrabHand* Hand)
 		HoldingHand = Hand;
 	}
 	
-	// 被抓取时取消选中状态
-	if (bIsSelected)
-	{
-		bIsSelected = false;
-	}
+	// 被抓取时取消选中状态（所有手的高亮一起撤销）
+	ClearGrabSelection();
 	
 	Execute_ExitStasis(this);
 }
@@ -162,34 +175,55 @@ void AGrabbeeObject::OnReleased_Implementation(UPlayerGrabHand* Hand)
 	HoldingHand = nullptr;
 }
 
-void AGrabbeeObject::OnGrabSelected_Implementation()
+void AGrabbeeObject::OnGrabSelected_Implementation(UPlayerGrabHand* Hand)
 {
+	SelectingHands.AddUnique(FObjectKey(Hand));
 	bIsSelected = true;
-	MeshComponent->SetCustomDepthStencilValue(4); // 使用 setter 方法确保渲染状态更新
+	UGrabHighlightSubsystem::SetHighlighted(MeshComponent, Hand, true);
+}
+
+void AGrabbeeObject::OnGrabDeselected_Implementation(UPlayerGrabHand* Hand)
+{
+	SelectingHands.RemoveSingleSwap(FObjectKey(Hand), EAllowShrinking::No);
+	bIsSelected = SelectingHands.Num() > 0;
+	UGrabHighlightSubsystem::SetHighlighted(MeshComponent, Hand, false);
 }
 
-void AGrabbeeObject::OnGrabDeselected_Implementation()
+void AGrabbeeObject::ClearGrabSelection()
 {
+	if (UGrabHighlightSubsystem* Highlights = UGrabHighlightSubsystem::Get(MeshComponent))
+	{
+		for (const FObjectKey& HandKey : SelectingHands)
+		{
+			Highlights->RemoveHighlightByKey(MeshComponent, HandKey);
+		}
+	}
+	SelectingHands.Reset();
 	bIsSelected = false;
-	MeshComponent->SetCustomDepthStencilValue(0); // 使用 setter 方法确保渲染状态更新
 }
 
 void AGrabbeeObject::EnterStasis_Implementation(double TimeToStasis)
 {
-	if (UPrimitiveComponent* Primitive = Execute_GetGrabPrimitive(this))
+	// 由定身管理统一冻结（记录速度、转运动学、到期自动解除）
+	if (UStasisSubsystem* Stasis = UStasisSubsystem::Get(this))
 	{
-		Primitive->SetSimulatePhysics(false);
-		bIsInStasis = true;
+		bIsInStasis = Stasis->Freeze(this, TimeToStasis);
 	}
 }
 
 void AGrabbeeObject::ExitStasis_Implementation()
 {
-	if (UPrimitiveComponent* Primitive = Execute_GetGrabPrimitive(this))
+	if (!bIsInStasis)
+	{
+		return;
+	}
+
+	// 被抓住时解除定身不释放蓄积的动量，否则物体会从手里弹出去
+	if (UStasisSubsystem* Stasis = UStasisSubsystem::Get(this))
 	{
-		Primitive->SetSimulatePhysics(true);
-		bIsInStasis = false;
+		Stasis->Release(this, !bIsHeld);
 	}
+	bIsInStasis = false;
 }
 
 bool AGrabbeeObject::IsInStasis_Implementation()
@@ -0,0 +1,363 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabber/DropPlacementSubsystem.h"
+#include "Game/GameSettings.h"
+#include "Game/VRTestStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "NavigationSystem.h"
+
+namespace DropPlacement
+{
+	/** 地面缓存的 Z 分层高度：同一 XY 的不同楼层互不干扰 */
+	constexpr float LayerHeight = 50.0f;
+
+	/** 从分层顶部向下最多查找的距离 */
+	constexpr float MaxDropHeight = 500.0f;
+
+	/** 期望位置通常就在地面上（射线命中点），抬高后再找地面，避免落到分层边界下方 */
+	constexpr float ProbeLift = 10.0f;
+
+	/** 放置时离地的间隙，避免初始穿透 */
+	constexpr float GroundSkin = 1.0f;
+
+	/** 空位检测时包围盒收缩量（包围盒比碰撞体略大，贴地时不应算作占用） */
+	constexpr float ClearanceShrink = 1.0f;
+
+	/** 缓存格子数上限，超出后整体清空 */
+	constexpr int32 MaxCachedCells = 4096;
+
+	/** 每圈候选点数量 */
+	constexpr int32 CandidatesPerRing = 8;
+
+	/** 瞄准命中面的法线 Z 分量下限（约 45 度），低于此值视为墙面，不直接放在命中点 */
+	constexpr float MinSurfaceNormalZ = 0.7f;
+
+	/** 只对一个组件做向下射线，命中面朝上才算落脚点 */
+	bool TraceSurfaceZ(UPrimitiveComponent* Surface, const FVector& Start, const FVector& End, float& OutGroundZ)
+	{
+		FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DropSurfaceSample), false);
+		FHitResult Hit;
+		if (!Surface->LineTraceComponent(Hit, Start, End, QueryParams) || Hit.ImpactNormal.Z < MinSurfaceNormalZ)
+		{
+			return false;
+		}
+
+		OutGroundZ = Hit.ImpactPoint.Z;
+		return true;
+	}
+
+	void Teleport(UPrimitiveComponent* Primitive, const FVector& Location, const FQuat& Rotation)
+	{
+		// ResetPhysics：传送并清零速度，放下后原地静止
+		Primitive->SetWorldLocationAndRotation(Location, Rotation, false, nullptr, ETeleportType::ResetPhysics);
+	}
+}
+
+UDropPlacementSubsystem* UDropPlacementSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UDropPlacementSubsystem>() : nullptr;
+}
+
+bool UDropPlacementSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDropPlacementSubsystem::Deinitialize()
+{
+	GroundCells.Reset();
+
+	Super::Deinitialize();
+}
+
+// ==================== 放置 ====================
+
+bool UDropPlacementSubsystem::PlaceComponent(UPrimitiveComponent* Primitive, const FVector& DesiredLocation, const FQuat& Rotation, FVector& OutLocation,
+	const FHitResult* SurfaceHit)
+{
+	FDropPlacementRequest Request;
+	Request.Primitive = Primitive;
+	Request.DesiredLocation = DesiredLocation;
+	Request.Rotation = Rotation;
+	if (SurfaceHit && SurfaceHit->bBlockingHit)
+	{
+		Request.SurfaceHit = *SurfaceHit;
+		Request.bHasSurfaceHit = true;
+	}
+
+	if (!FindPlacement(Request, OutLocation))
+	{
+		return false;
+	}
+
+	DropPlacement::Teleport(Primitive, OutLocation, Rotation);
+	return true;
+}
+
+int32 UDropPlacementSubsystem::PlaceComponents(TArrayView<const FDropPlacementRequest> Requests, TArray<FDropPlacementResult>& OutResults)
+{
+	OutResults.Reset(Requests.Num());
+	OutResults.AddDefaulted(Requests.Num());
+
+	// 批量中的物体还在原位置，重叠测试时忽略它们，互相避让改用已确定的包围盒
+	TArray<const AActor*, TInlineAllocator<16>> IgnoredActors;
+	for (const FDropPlacementRequest& Request : Requests)
+	{
+		if (Request.Primitive && Request.Primitive->GetOwner())
+		{
+			IgnoredActors.AddUnique(Request.Primitive->GetOwner());
+		}
+	}
+
+	TArray<FBox, TInlineAllocator<16>> Occupied;
+	int32 PlacedCount = 0;
+
+	for (int32 Index = 0; Index < Requests.Num(); ++Index)
+	{
+		const FDropPlacementRequest& Request = Requests[Index];
+		FDropPlacementResult& Result = OutResults[Index];
+
+		if (!FindPlacement(Request, Result.Location, Occupied, IgnoredActors))
+		{
+			continue;
+		}
+
+		DropPlacement::Teleport(Request.Primitive, Result.Location, Request.Rotation);
+		Occupied.Add(Request.Primitive->Bounds.GetBox());
+		Result.bPlaced = true;
+		++PlacedCount;
+	}
+
+	return PlacedCount;
+}
+
+bool UDropPlacementSubsystem::FindPlacement(const FDropPlacementRequest& Request, FVector& OutLocation,
+	TArrayView<const FBox> Occupied, TArrayView<const AActor* const> IgnoredActors)
+{
+	UPrimitiveComponent* Primitive = Request.Primitive;
+	UWorld* World = GetWorld();
+	if (!Primitive || !World)
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_VRTest_DropPlacement);
+
+	const UGameSettings* Settings = UGameSettings::Get();
+	const float CellSize = Settings ? Settings->DropGroundCellSize : 25.0f;
+	const int32 SearchRings = Settings ? Settings->DropSearchRings : 2;
+
+	// 目标旋转下的包围盒（相对组件原点）
+	const FBoxSphereBounds LocalBounds = Primitive->CalcBounds(FTransform(Request.Rotation, FVector::ZeroVector, Primitive->GetComponentScale()));
+	const FVector BoundsOffset = LocalBounds.Origin;
+	const FVector Extent = LocalBounds.BoxExtent;
+	const FCollisionShape ClearanceShape = FCollisionShape::MakeBox(
+		(Extent - FVector(DropPlacement::ClearanceShrink)).ComponentMax(FVector(0.5f)));
+
+	// 重叠测试按物体自身的碰撞通道和响应
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DropPlacementClearance), false, Primitive->GetOwner());
+	for (const AActor* IgnoredActor : IgnoredActors)
+	{
+		QueryParams.AddIgnoredActor(IgnoredActor);
+	}
+	FCollisionResponseParams ResponseParams;
+	Primitive->InitSweepCollisionParams(QueryParams, ResponseParams);
+	const ECollisionChannel Channel = Primitive->GetCollisionObjectType();
+
+	// 瞄准命中面朝上：期望位置改为命中点，周围候选点优先在命中的组件上找
+	UPrimitiveComponent* Surface = nullptr;
+	bool bUseSurfaceHit = false;
+	FVector DesiredLocation = Request.DesiredLocation;
+	if (Request.bHasSurfaceHit && Request.SurfaceHit.ImpactNormal.Z >= DropPlacement::MinSurfaceNormalZ)
+	{
+		Surface = Request.SurfaceHit.GetComponent();
+		bUseSurfaceHit = true;
+		DesiredLocation = Request.SurfaceHit.ImpactPoint;
+	}
+
+	// 斜面上包围盒的下沿要整体抬高，否则低的一侧会与斜面重叠
+	const float SlopeLift = bUseSurfaceHit
+		? FMath::Max(Extent.X, Extent.Y) * FMath::Sqrt(FMath::Max(0.0f, 1.0f - FMath::Square(Request.SurfaceHit.ImpactNormal.Z))) / Request.SurfaceHit.ImpactNormal.Z
+		: 0.0f;
+
+	// 候选点：期望位置，然后向外每圈 8 个点，圈距为物体水平尺寸
+	const float RingStep = FMath::Max(FMath::Max(Extent.X, Extent.Y) * 2.0f, CellSize);
+
+	for (int32 Ring = 0; Ring <= SearchRings; ++Ring)
+	{
+		const int32 NumCandidates = Ring == 0 ? 1 : DropPlacement::CandidatesPerRing;
+		for (int32 Candidate = 0; Candidate < NumCandidates; ++Candidate)
+		{
+			const float Angle = Candidate * (UE_TWO_PI / DropPlacement::CandidatesPerRing);
+			const FVector Probe = DesiredLocation + FVector(0.0f, 0.0f, DropPlacement::ProbeLift)
+				+ FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * (Ring * RingStep);
+
+			// 中心点直接用命中点；其余点先在命中组件上找，找不到才用场景地面缓存
+			float GroundZ;
+			float Lift = 0.0f;
+			if (bUseSurfaceHit && Ring == 0)
+			{
+				GroundZ = DesiredLocation.Z;
+				Lift = SlopeLift;
+			}
+			else if (Surface && FindGroundZ(Probe, GroundZ, Surface))
+			{
+				Lift = SlopeLift;
+			}
+			else if (!FindGroundZ(Probe, GroundZ))
+			{
+				continue;
+			}
+
+			const FVector BoundsCenter(Probe.X, Probe.Y, GroundZ + Lift + Extent.Z + DropPlacement::GroundSkin);
+			const FBox CandidateBox(BoundsCenter - Extent, BoundsCenter + Extent);
+
+			bool bOccupied = false;
+			for (const FBox& Box : Occupied)
+			{
+				if (Box.Intersect(CandidateBox))
+				{
+					bOccupied = true;
+					break;
+				}
+			}
+			if (bOccupied)
+			{
+				continue;
+			}
+
+			if (World->OverlapBlockingTestByChannel(BoundsCenter, FQuat::Identity, Channel, ClearanceShape, QueryParams, ResponseParams))
+			{
+				continue;
+			}
+
+			OutLocation = BoundsCenter - BoundsOffset;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// ==================== 地面缓存 ====================
+
+bool UDropPlacementSubsystem::FindGroundZ(const FVector& Location, float& OutGroundZ, UPrimitiveComponent* Surface)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	// 可移动的表面（动态物体、会动的平台）位置随时在变，不缓存，直接在该点检测
+	if (Surface && Surface->Mobility != EComponentMobility::Static)
+	{
+		return DropPlacement::TraceSurfaceZ(Surface, Location + FVector(0.0f, 0.0f, DropPlacement::LayerHeight),
+			Location - FVector(0.0f, 0.0f, DropPlacement::MaxDropHeight), OutGroundZ);
+	}
+
+	const FIntVector CellKey = GetCellKey(Location);
+
+	const UGameSettings* Settings = UGameSettings::Get();
+	const float Lifetime = Settings ? Settings->DropGroundCacheLifetime : 10.0f;
+	const double Now = World->GetTimeSeconds();
+
+	FGroundCellKey Key;
+	Key.Surface = FObjectKey(Surface);
+	Key.Cell = CellKey;
+
+	FGroundCell* Cell = GroundCells.Find(Key);
+	if (!Cell || (Lifetime > 0.0f && Now - Cell->SampleTime > Lifetime))
+	{
+		if (!Cell && GroundCells.Num() >= DropPlacement::MaxCachedCells)
+		{
+			GroundCells.Reset();
+		}
+
+		Cell = &GroundCells.FindOrAdd(Key);
+		SampleGroundCell(CellKey, Surface, *Cell);
+		Cell->SampleTime = Now;
+	}
+
+	OutGroundZ = Cell->GroundZ;
+	return Cell->bHasGround;
+}
+
+void UDropPlacementSubsystem::InvalidateGroundCache()
+{
+	GroundCells.Reset();
+}
+
+void UDropPlacementSubsystem::SampleGroundCell(const FIntVector& CellKey, UPrimitiveComponent* Surface, FGroundCell& OutCell) const
+{
+	OutCell.bHasGround = false;
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	INC_DWORD_STAT(STAT_VRTest_DropGroundSamples);
+
+	const UGameSettings* Settings = UGameSettings::Get();
+	const float CellSize = Settings ? Settings->DropGroundCellSize : 25.0f;
+
+	const float CenterX = (CellKey.X + 0.5f) * CellSize;
+	const float CenterY = (CellKey.Y + 0.5f) * CellSize;
+	const float TopZ = (CellKey.Z + 1) * DropPlacement::LayerHeight;
+	const float BottomZ = TopZ - DropPlacement::LayerHeight - DropPlacement::MaxDropHeight;
+
+	// 指定表面：只检测该组件（桌面、架子），面朝侧面的命中不算落脚点
+	if (Surface)
+	{
+		OutCell.bHasGround = DropPlacement::TraceSurfaceZ(Surface, FVector(CenterX, CenterY, TopZ), FVector(CenterX, CenterY, BottomZ), OutCell.GroundZ);
+		return;
+	}
+
+	// NavMesh 投影：不做物理查询
+	if (Settings && Settings->bDropUseNavMesh)
+	{
+		if (const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World))
+		{
+			const float HalfHeight = (TopZ - BottomZ) * 0.5f;
+			FNavLocation NavLocation;
+			if (NavSys->ProjectPointToNavigation(FVector(CenterX, CenterY, BottomZ + HalfHeight), NavLocation,
+				FVector(CellSize * 0.5f, CellSize * 0.5f, HalfHeight)))
+			{
+				OutCell.GroundZ = NavLocation.Location.Z;
+				OutCell.bHasGround = true;
+				return;
+			}
+		}
+	}
+
+	// 向下射线：只查静态场景，缓存结果与动态物体无关
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(DropGroundSample), false);
+	FHitResult Hit;
+	if (World->LineTraceSingleByObjectType(Hit, FVector(CenterX, CenterY, TopZ), FVector(CenterX, CenterY, BottomZ),
+		FCollisionObjectQueryParams(ECC_WorldStatic), QueryParams))
+	{
+		OutCell.GroundZ = Hit.ImpactPoint.Z;
+		OutCell.bHasGround = true;
+	}
+}
+
+FIntVector UDropPlacementSubsystem::GetCellKey(const FVector& Location) const
+{
+	const UGameSettings* Settings = UGameSettings::Get();
+	const float CellSize = Settings ? Settings->DropGroundCellSize : 25.0f;
+
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / DropPlacement::LayerHeight));
+}
@@ -0,0 +1,235 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabber/GrabConstraintDriverSubsystem.h"
+#include "Grabber/PlayerGrabHand.h"
+#include "PhysicsEngine/PhysicsHandleComponent.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "MotionControllerComponent.h"
+#include "IMotionController.h"
+#include "Features/IModularFeatures.h"
+#include "GameFramework/WorldSettings.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+
+// ==================== Tick 函数 ====================
+
+void FGrabConstraintDriverTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Driver && TickType != LEVELTICK_ViewportsOnly)
+	{
+		Driver->UpdateGrabTargets(DeltaTime);
+	}
+}
+
+FString FGrabConstraintDriverTickFunction::DiagnosticMessage()
+{
+	return TEXT("FGrabConstraintDriverTickFunction");
+}
+
+// ==================== 子系统 ====================
+
+UGrabConstraintDriverSubsystem* UGrabConstraintDriverSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UGrabConstraintDriverSubsystem>() : nullptr;
+}
+
+bool UGrabConstraintDriverSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGrabConstraintDriverSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	DriverTickFunction.Driver = this;
+	DriverTickFunction.bCanEverTick = true;
+	DriverTickFunction.bStartWithTickEnabled = true;
+	DriverTickFunction.TickGroup = TG_PrePhysics;
+	DriverTickFunction.RegisterTickFunction(InWorld.PersistentLevel);
+	bTickRegistered = true;
+
+	if (FPhysScene_Chaos* PhysScene = InWorld.GetPhysicsScene())
+	{
+		PhysScenePreTickHandle = PhysScene->OnPhysScenePreTick.AddUObject(this, &UGrabConstraintDriverSubsystem::OnPhysScenePreTick);
+	}
+
+	// 先于 OnWorldBeginPlay 注册的手（一般没有），补建依赖
+	for (const TWeakObjectPtr<UPlayerGrabHand>& Hand : Hands)
+	{
+		RefreshHandPrerequisites(Hand.Get());
+	}
+}
+
+void UGrabConstraintDriverSubsystem::Deinitialize()
+{
+	if (bTickRegistered)
+	{
+		DriverTickFunction.UnRegisterTickFunction();
+		bTickRegistered = false;
+	}
+	DriverTickFunction.Driver = nullptr;
+
+	if (PhysScenePreTickHandle.IsValid())
+	{
+		if (FPhysScene_Chaos* PhysScene = GetWorld() ? GetWorld()->GetPhysicsScene() : nullptr)
+		{
+			PhysScene->OnPhysScenePreTick.Remove(PhysScenePreTickHandle);
+		}
+		PhysScenePreTickHandle.Reset();
+	}
+	LastPhysicsStepTime = 0.0f;
+
+	Hands.Reset();
+	PendingTargets.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UGrabConstraintDriverSubsystem::RegisterHand(UPlayerGrabHand* Hand)
+{
+	if (!Hand)
+	{
+		return false;
+	}
+
+	Hands.AddUnique(Hand);
+	RefreshHandPrerequisites(Hand);
+	return true;
+}
+
+void UGrabConstraintDriverSubsystem::UnregisterHand(UPlayerGrabHand* Hand)
+{
+	Hands.Remove(Hand);
+}
+
+void UGrabConstraintDriverSubsystem::RefreshHandPrerequisites(UPlayerGrabHand* Hand)
+{
+	if (!Hand || !bTickRegistered)
+	{
+		return;
+	}
+
+	// 手的位姿来自父组件（MotionController）：父组件先更新
+	if (USceneComponent* Parent = Hand->GetAttachParent())
+	{
+		if (Parent->PrimaryComponentTick.bCanEverTick)
+		{
+			DriverTickFunction.AddPrerequisite(Parent, Parent->PrimaryComponentTick);
+		}
+	}
+
+	// 手自身的 Tick（手势检测等）读取本帧的运动采样
+	Hand->PrimaryComponentTick.AddPrerequisite(this, DriverTickFunction);
+
+	// PhysicsHandle 在本驱动之后 Tick，同一帧内就把新目标插值并写入物理
+	if (UPhysicsHandleComponent* PhysicsHandle = Hand->CachedPhysicsHandle)
+	{
+		PhysicsHandle->PrimaryComponentTick.AddPrerequisite(this, DriverTickFunction);
+	}
+}
+
+void UGrabConstraintDriverSubsystem::UpdateGrabTargets(float DeltaTime)
+{
+	PendingTargets.Reset();
+
+	// 1. 先采样所有手的位姿（双手抓取的目标需要两只手本帧的位姿）
+	for (int32 Index = Hands.Num() - 1; Index >= 0; --Index)
+	{
+		UPlayerGrabHand* Hand = Hands[Index].Get();
+		if (!Hand)
+		{
+			Hands.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// 外推到本次物理步进的末尾（还没有记录步长时用帧间隔）
+		Hand->UpdateHandMotion(LastPhysicsStepTime > 0.0f ? LastPhysicsStepTime : DeltaTime);
+	}
+
+	// 2. 持有物体的手重新读取控制器最新位姿，再计算目标（双手抓取读取搭档位姿，所以先全部读取）
+	for (const TWeakObjectPtr<UPlayerGrabHand>& HandPtr : Hands)
+	{
+		UPlayerGrabHand* Hand = HandPtr.Get();
+		FTransform LatestTransform;
+		if (Hand && Hand->bIsHolding && PollLatestHandTransform(Hand, LatestTransform))
+		{
+			Hand->SetLatestHandTransform(LatestTransform);
+		}
+	}
+
+	for (const TWeakObjectPtr<UPlayerGrabHand>& HandPtr : Hands)
+	{
+		UPlayerGrabHand* Hand = HandPtr.Get();
+		if (!Hand)
+		{
+			continue;
+		}
+
+		FPendingGrabTarget Target;
+		if (!Hand->ComputeGrabTarget(Target.Location, Target.Rotation))
+		{
+			continue;
+		}
+		Target.PhysicsHandle = Hand->CachedPhysicsHandle;
+
+		// 换手过程中两只手可能指向同一组件/骨骼：只保留一个
+		const bool bDuplicate = PendingTargets.ContainsByPredicate([&Target](const FPendingGrabTarget& Other)
+		{
+			return Other.PhysicsHandle->GrabbedComponent == Target.PhysicsHandle->GrabbedComponent &&
+				Other.PhysicsHandle->GrabbedBoneName == Target.PhysicsHandle->GrabbedBoneName;
+		});
+		if (!bDuplicate)
+		{
+			PendingTargets.Add(Target);
+		}
+	}
+
+	// 3. 统一写入
+	for (const FPendingGrabTarget& Target : PendingTargets)
+	{
+		Target.PhysicsHandle->SetTargetLocationAndRotation(Target.Location, Target.Rotation);
+	}
+}
+
+bool UGrabConstraintDriverSubsystem::PollLatestHandTransform(const UPlayerGrabHand* Hand, FTransform& OutTransform)
+{
+	const UMotionControllerComponent* Controller = Hand ? Cast<UMotionControllerComponent>(Hand->GetAttachParent()) : nullptr;
+	const UWorld* World = Hand ? Hand->GetWorld() : nullptr;
+	if (!Controller || !World || !World->GetWorldSettings())
+	{
+		return false;
+	}
+
+	const float WorldToMeters = World->GetWorldSettings()->WorldToMeters;
+	const TArray<IMotionController*> MotionControllers = IModularFeatures::Get().GetModularFeatureImplementations<IMotionController>(IMotionController::GetModularFeatureName());
+	for (const IMotionController* MotionController : MotionControllers)
+	{
+		FRotator Orientation;
+		FVector Position;
+		if (!MotionController || !MotionController->GetControllerOrientationAndPosition(Controller->PlayerIndex, Controller->MotionSource, Orientation, Position, WorldToMeters))
+		{
+			continue;
+		}
+
+		// 追踪位姿在追踪原点（控制器父组件，即 VROrigin）空间下
+		const FTransform TrackingToWorld = Controller->GetAttachParent() ? Controller->GetAttachParent()->GetComponentTransform() : FTransform::Identity;
+		const FTransform ControllerTransform = FTransform(Orientation, Position, Controller->GetRelativeScale3D()) * TrackingToWorld;
+		OutTransform = Hand->GetRelativeTransform() * ControllerTransform;
+		return true;
+	}
+
+	return false;
+}
+
+void UGrabConstraintDriverSubsystem::OnPhysScenePreTick(FPhysScene_Chaos* PhysScene, float DeltaTime)
+{
+	LastPhysicsStepTime = DeltaTime;
+}
@@ -0,0 +1,162 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabber/GrabHighlightSubsystem.h"
+#include "Game/VRTestStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UGrabHighlightSubsystem* UGrabHighlightSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UGrabHighlightSubsystem>() : nullptr;
+}
+
+void UGrabHighlightSubsystem::SetHighlighted(UPrimitiveComponent* Primitive, const UObject* Requester, bool bHighlighted, int32 StencilValue)
+{
+	UGrabHighlightSubsystem* Highlights = Get(Primitive);
+	if (!Highlights)
+	{
+		return;
+	}
+
+	if (bHighlighted)
+	{
+		Highlights->AddHighlight(Primitive, Requester, StencilValue);
+	}
+	else
+	{
+		Highlights->RemoveHighlight(Primitive, Requester);
+	}
+}
+
+bool UGrabHighlightSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGrabHighlightSubsystem::Deinitialize()
+{
+	Entries.Reset();
+	DirtyPrimitives.Reset();
+	AppliedCount = 0;
+	SET_DWORD_STAT(STAT_VRTest_CustomDepthPrimitives, 0);
+
+	Super::Deinitialize();
+}
+
+void UGrabHighlightSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	FlushHighlights();
+}
+
+bool UGrabHighlightSubsystem::IsTickable() const
+{
+	// 没有待写入的变化时不 Tick
+	return DirtyPrimitives.Num() > 0;
+}
+
+TStatId UGrabHighlightSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGrabHighlightSubsystem, STATGROUP_Tickables);
+}
+
+// ==================== 请求 ====================
+
+void UGrabHighlightSubsystem::AddHighlight(UPrimitiveComponent* Primitive, const UObject* Requester, int32 StencilValue)
+{
+	if (!Primitive)
+	{
+		return;
+	}
+
+	const FObjectKey PrimitiveKey(Primitive);
+	FHighlightEntry& Entry = Entries.FindOrAdd(PrimitiveKey);
+	Entry.Primitive = Primitive;
+	Entry.Requesters.AddUnique(FObjectKey(Requester));
+	Entry.StencilValue = StencilValue;
+
+	DirtyPrimitives.Add(PrimitiveKey);
+}
+
+void UGrabHighlightSubsystem::RemoveHighlight(UPrimitiveComponent* Primitive, const UObject* Requester)
+{
+	RemoveHighlightByKey(Primitive, FObjectKey(Requester));
+}
+
+void UGrabHighlightSubsystem::RemoveHighlightByKey(UPrimitiveComponent* Primitive, const FObjectKey& RequesterKey)
+{
+	const FObjectKey PrimitiveKey(Primitive);
+	FHighlightEntry* Entry = Primitive ? Entries.Find(PrimitiveKey) : nullptr;
+	if (!Entry)
+	{
+		return;
+	}
+
+	Entry->Requesters.RemoveSingleSwap(RequesterKey, EAllowShrinking::No);
+	DirtyPrimitives.Add(PrimitiveKey);
+}
+
+void UGrabHighlightSubsystem::RemoveAllHighlights(const UObject* Requester)
+{
+	const FObjectKey RequesterKey(Requester);
+	for (TPair<FObjectKey, FHighlightEntry>& Pair : Entries)
+	{
+		if (Pair.Value.Requesters.RemoveSingleSwap(RequesterKey, EAllowShrinking::No) > 0)
+		{
+			DirtyPrimitives.Add(Pair.Key);
+		}
+	}
+}
+
+void UGrabHighlightSubsystem::FlushHighlights()
+{
+	for (const FObjectKey& PrimitiveKey : DirtyPrimitives)
+	{
+		FHighlightEntry* Entry = Entries.Find(PrimitiveKey);
+		if (!Entry)
+		{
+			continue;
+		}
+
+		UPrimitiveComponent* Primitive = Entry->Primitive.Get();
+		const bool bWanted = Primitive && Entry->Requesters.Num() > 0;
+
+		if (bWanted)
+		{
+			// 每个 setter 都会标记渲染状态脏，只在值真正变化时调用
+			if (Primitive->CustomDepthStencilValue != Entry->StencilValue)
+			{
+				Primitive->SetCustomDepthStencilValue(Entry->StencilValue);
+			}
+			if (!Entry->bApplied)
+			{
+				Primitive->SetRenderCustomDepth(true);
+				Entry->bApplied = true;
+				++AppliedCount;
+			}
+			continue;
+		}
+
+		if (Entry->bApplied)
+		{
+			if (Primitive)
+			{
+				Primitive->SetRenderCustomDepth(false);
+				Primitive->SetCustomDepthStencilValue(0);
+			}
+			--AppliedCount;
+		}
+		Entries.Remove(PrimitiveKey);
+	}
+
+	DirtyPrimitives.Reset();
+	SET_DWORD_STAT(STAT_VRTest_CustomDepthPrimitives, AppliedCount);
+}
@@ -0,0 +1,288 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabber/GrabbableRegistrySubsystem.h"
+#include "Grabber/IGrabbable.h"
+#include "Grabber/VRGrabHand.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+namespace GrabbableRegistry
+{
+	/** 每只手锥形候选最多保留的数量（近距离候选不截断） */
+	constexpr int32 MaxCandidates = 8;
+
+	/** 按分数（小的优先）插入有序数组，超过 MaxCount 时丢掉最后一个 */
+	template <typename ScoreArrayType, typename ActorArrayType>
+	void InsertSorted(ScoreArrayType& Scores, ActorArrayType& Actors, float Score, AActor* Actor, int32 MaxCount)
+	{
+		int32 Slot = Scores.Num();
+		while (Slot > 0 && Scores[Slot - 1] > Score)
+		{
+			--Slot;
+		}
+		if (Slot >= MaxCount)
+		{
+			return;
+		}
+
+		Scores.Insert(Score, Slot);
+		Actors.Insert(Actor, Slot);
+		if (Scores.Num() > MaxCount)
+		{
+			Scores.Pop(EAllowShrinking::No);
+			Actors.Pop(EAllowShrinking::No);
+		}
+	}
+}
+
+UGrabbableRegistrySubsystem* UGrabbableRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UGrabbableRegistrySubsystem>() : nullptr;
+}
+
+void UGrabbableRegistrySubsystem::RegisterGrabbable(AActor* Actor)
+{
+	if (UGrabbableRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->Register(Actor);
+	}
+}
+
+void UGrabbableRegistrySubsystem::UnregisterGrabbable(AActor* Actor)
+{
+	if (UGrabbableRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->Unregister(Actor);
+	}
+}
+
+bool UGrabbableRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UGrabbableRegistrySubsystem::Deinitialize()
+{
+	Index.Reset();
+	Hands.Reset();
+	HandQueries.Reset();
+	HandResults.Reset();
+
+	Super::Deinitialize();
+}
+
+// ==================== 注册 ====================
+
+void UGrabbableRegistrySubsystem::Register(AActor* Actor)
+{
+	if (!IsValid(Actor) || !Actor->Implements<UGrabbable>())
+	{
+		return;
+	}
+
+	const UPrimitiveComponent* GrabPrimitive = IGrabbable::Execute_GetGrabPrimitive(Actor);
+	Index.Add(Actor, GrabPrimitive);
+}
+
+void UGrabbableRegistrySubsystem::Unregister(AActor* Actor)
+{
+	Index.Remove(Actor);
+}
+
+void UGrabbableRegistrySubsystem::RegisterHand(UVRGrabHand* Hand)
+{
+	if (!Hand || Hands.Contains(Hand))
+	{
+		return;
+	}
+
+	Hands.Add(Hand);
+	HandQueries.AddDefaulted();
+	HandResults.AddDefaulted();
+	LastHandQueryFrame = MAX_uint64;
+}
+
+void UGrabbableRegistrySubsystem::UnregisterHand(UVRGrabHand* Hand)
+{
+	const int32 HandIndex = Hands.Find(Hand);
+	if (HandIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	Hands.RemoveAt(HandIndex);
+	HandQueries.RemoveAt(HandIndex);
+	HandResults.RemoveAt(HandIndex);
+}
+
+// ==================== 查询 ====================
+
+const FGrabbableQueryResult* UGrabbableRegistrySubsystem::GetHandQueryResult(const UVRGrabHand* Hand)
+{
+	const int32 HandIndex = Hands.IndexOfByKey(Hand);
+	if (HandIndex == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	if (LastHandQueryFrame != GFrameCounter)
+	{
+		UpdateHandQueries();
+	}
+
+	return &HandResults[HandIndex];
+}
+
+void UGrabbableRegistrySubsystem::UpdateHandQueries()
+{
+	LastHandQueryFrame = GFrameCounter;
+
+	for (int32 HandIndex = 0; HandIndex < Hands.Num(); ++HandIndex)
+	{
+		if (const UVRGrabHand* Hand = Hands[HandIndex].Get())
+		{
+			HandQueries[HandIndex] = Hand->BuildGrabbableQuery();
+		}
+		else
+		{
+			// 已销毁的手：空查询
+			HandQueries[HandIndex] = FGrabbableQuery();
+		}
+	}
+
+	RunQueries(HandQueries, HandResults);
+}
+
+void UGrabbableRegistrySubsystem::RunQueries(TArrayView<const FGrabbableQuery> Queries, TArray<FGrabbableQueryResult>& OutResults)
+{
+	using namespace GrabbableRegistry;
+
+	OutResults.SetNum(Queries.Num());
+	for (FGrabbableQueryResult& Result : OutResults)
+	{
+		Result.Reset();
+	}
+	if (Queries.Num() == 0)
+	{
+		return;
+	}
+
+	RefreshIndex();
+
+	// 所有查询的外包球：只遍历一次空间索引
+	FVector Center = FVector::ZeroVector;
+	for (const FGrabbableQuery& Query : Queries)
+	{
+		Center += Query.Origin + Query.NearOrigin;
+	}
+	Center /= Queries.Num() * 2;
+
+	float Radius = 0.0f;
+	for (const FGrabbableQuery& Query : Queries)
+	{
+		Radius = FMath::Max(Radius, FVector::Dist(Center, Query.Origin) + Query.ConeDistance);
+		Radius = FMath::Max(Radius, FVector::Dist(Center, Query.NearOrigin) + Query.NearRadius);
+	}
+
+	// 每个查询的候选分数（与结果中的 Actor 数组一一对应）
+	TArray<TArray<float, TInlineAllocator<MaxCandidates + 1>>, TInlineAllocator<2>> ConeScores;
+	TArray<TArray<float, TInlineAllocator<MaxCandidates>>, TInlineAllocator<2>> NearScores;
+	ConeScores.SetNum(Queries.Num());
+	NearScores.SetNum(Queries.Num());
+
+	const TArray<FVector>& Positions = Index.GetPositions();
+	const TArray<float>& Radii = Index.GetRadii();
+
+	Index.ForEachInSphere(Center, Radius, [&](int32 EntryIndex)
+	{
+		const FVector& Position = Positions[EntryIndex];
+		const float EntryRadius = Radii[EntryIndex];
+		AActor* Actor = nullptr;
+
+		for (int32 QueryIndex = 0; QueryIndex < Queries.Num(); ++QueryIndex)
+		{
+			const FGrabbableQuery& Query = Queries[QueryIndex];
+			const FVector ToTarget = Position - Query.Origin;
+			const float DistSq = ToTarget.SizeSquared();
+
+			// 近距离：包围球与抓取球相交（以当前手部位置为球心）
+			const float NearDistSq = FVector::DistSquared(Position, Query.NearOrigin);
+			const float NearReach = Query.NearRadius + EntryRadius;
+			const bool bNear = Query.NearRadius > 0.0f && NearDistSq <= NearReach * NearReach;
+
+			// 锥形：在距离内，且 dot >= cos * |v|（两边平方比较）
+			const float ConeReach = Query.ConeDistance + EntryRadius;
+			const float Dot = FVector::DotProduct(Query.Forward, ToTarget);
+			const bool bInCone = Query.ConeDistance > 0.0f && DistSq <= ConeReach * ConeReach &&
+				Dot > 0.0f && Dot * Dot >= Query.ConeCosAngle * Query.ConeCosAngle * DistSq;
+
+			if (!bNear && !bInCone)
+			{
+				continue;
+			}
+
+			// 只有通过几何筛选的条目才访问 Actor
+			if (!Actor)
+			{
+				Actor = Index.GetActor(EntryIndex);
+				if (!Actor || Actor->IsHidden() || !Actor->GetActorEnableCollision())
+				{
+					return;
+				}
+			}
+			if (Actor == Query.IgnoreActor)
+			{
+				continue;
+			}
+
+			// 接口判断放在截断之前：不能抓的物体（插着的箭、另一只手拿着的武器等）不占候选名额
+			if (Query.Hand && !IGrabbable::Execute_CanBeGrabbedBy(Actor, Query.Hand))
+			{
+				continue;
+			}
+
+			if (bNear)
+			{
+				InsertSorted(NearScores[QueryIndex], OutResults[QueryIndex].NearCandidates, NearDistSq, Actor, MAX_int32);
+			}
+			if (bInCone && (!Query.Hand || IGrabbable::Execute_CanBeGrabbedByGravityGlove(Actor)))
+			{
+				// 分数 = -cos，越对准越靠前
+				const float CosAngle = DistSq > KINDA_SMALL_NUMBER ? Dot * FMath::InvSqrt(DistSq) : 1.0f;
+				InsertSorted(ConeScores[QueryIndex], OutResults[QueryIndex].ConeCandidates, -CosAngle, Actor, MaxCandidates);
+			}
+		}
+	});
+
+	for (int32 QueryIndex = 0; QueryIndex < Queries.Num(); ++QueryIndex)
+	{
+		for (const float Score : ConeScores[QueryIndex])
+		{
+			OutResults[QueryIndex].ConeCosAngles.Add(-Score);
+		}
+	}
+}
+
+const FActorSpatialIndex& UGrabbableRegistrySubsystem::GetSpatialIndex()
+{
+	RefreshIndex();
+	return Index;
+}
+
+void UGrabbableRegistrySubsystem::RefreshIndex()
+{
+	if (LastRefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastRefreshFrame = GFrameCounter;
+	Index.Refresh();
+}
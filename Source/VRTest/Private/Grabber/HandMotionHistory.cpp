@@ -0,0 +1,183 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabber/HandMotionHistory.h"
+
+void FHandMotionHistory::AddSample(double Time, const FVector& Location, const FQuat& Rotation, float VelocityWindow)
+{
+	if (Count > 0)
+	{
+		const FHandMotionSample& Newest = GetSample(0);
+		if (Time <= Newest.Time)
+		{
+			return;
+		}
+		if (FVector::DistSquared(Newest.Location, Location) > FMath::Square(TeleportDistance))
+		{
+			Reset();
+		}
+	}
+
+	Head = (Head + 1) % Capacity;
+	Count = FMath::Min(Count + 1, Capacity);
+
+	FHandMotionSample& Sample = Samples[Head];
+	Sample.Time = Time;
+	Sample.Location = Location;
+	Sample.Rotation = Rotation;
+
+	FVector Acceleration;
+	EstimateMotion(VelocityWindow, Sample.Velocity, Acceleration);
+}
+
+void FHandMotionHistory::Reset()
+{
+	Head = INDEX_NONE;
+	Count = 0;
+}
+
+const FHandMotionSample& FHandMotionHistory::GetSample(int32 AgeIndex) const
+{
+	check(AgeIndex >= 0 && AgeIndex < Count);
+	return Samples[(Head - AgeIndex + Capacity) % Capacity];
+}
+
+bool FHandMotionHistory::EstimateMotion(float Window, FVector& OutVelocity, FVector& OutAcceleration) const
+{
+	OutVelocity = FVector::ZeroVector;
+	OutAcceleration = FVector::ZeroVector;
+	if (Count < 2)
+	{
+		return false;
+	}
+
+	// 时间以窗口长度归一化、位置相对最新采样，正规方程的系数保持在 O(1)
+	const FHandMotionSample& Newest = GetSample(0);
+	const double TimeScale = Window > KINDA_SMALL_NUMBER ? 1.0 / Window : 1.0;
+
+	double S0 = 0.0, S1 = 0.0, S2 = 0.0, S3 = 0.0, S4 = 0.0;
+	FVector3d P0 = FVector3d::ZeroVector, P1 = FVector3d::ZeroVector, P2 = FVector3d::ZeroVector;
+	int32 Used = 0;
+
+	for (int32 AgeIndex = 0; AgeIndex < Count; ++AgeIndex)
+	{
+		const FHandMotionSample& Sample = GetSample(AgeIndex);
+		const double T = (Sample.Time - Newest.Time) * TimeScale;
+		if (Used >= 2 && T < -1.0)
+		{
+			break;
+		}
+
+		const FVector3d P = FVector3d(Sample.Location - Newest.Location);
+		const double T2 = T * T;
+		S0 += 1.0;
+		S1 += T;
+		S2 += T2;
+		S3 += T2 * T;
+		S4 += T2 * T2;
+		P0 += P;
+		P1 += P * T;
+		P2 += P * T2;
+		++Used;
+	}
+
+	// 二次拟合 p(t) = a + b*t + c*t²：最新时刻 v = b，acc = 2c（Cramer 法则）
+	if (Used >= 3)
+	{
+		const double Det = S0 * (S2 * S4 - S3 * S3) - S1 * (S1 * S4 - S3 * S2) + S2 * (S1 * S3 - S2 * S2);
+		if (FMath::Abs(Det) > UE_DOUBLE_SMALL_NUMBER)
+		{
+			const FVector3d DetB = S0 * (P1 * S4 - P2 * S3) - P0 * (S1 * S4 - S3 * S2) + S2 * (P2 * S1 - P1 * S2);
+			const FVector3d DetC = S0 * (P2 * S2 - P1 * S3) - S1 * (P2 * S1 - P1 * S2) + P0 * (S1 * S3 - S2 * S2);
+			OutVelocity = FVector(DetB / Det * TimeScale);
+			OutAcceleration = FVector(DetC / Det * (2.0 * TimeScale * TimeScale));
+			return true;
+		}
+	}
+
+	// 线性拟合
+	const double Denominator = S0 * S2 - S1 * S1;
+	if (Denominator <= UE_DOUBLE_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	OutVelocity = FVector((P1 * S0 - P0 * S1) / Denominator * TimeScale);
+	return true;
+}
+
+FVector FHandMotionHistory::EstimateAngularVelocity(float Window) const
+{
+	if (Count < 2)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// 窗口内最旧的采样（至少用前一帧）
+	const FHandMotionSample& Newest = GetSample(0);
+	int32 OldestIndex = 1;
+	while (OldestIndex + 1 < Count && Newest.Time - GetSample(OldestIndex + 1).Time <= Window)
+	{
+		++OldestIndex;
+	}
+
+	const FHandMotionSample& Oldest = GetSample(OldestIndex);
+	const double DeltaTime = Newest.Time - Oldest.Time;
+	if (DeltaTime <= UE_DOUBLE_SMALL_NUMBER)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// 取最短弧
+	FQuat Delta = Newest.Rotation * Oldest.Rotation.Inverse();
+	if (Delta.W < 0.0f)
+	{
+		Delta = FQuat(-Delta.X, -Delta.Y, -Delta.Z, -Delta.W);
+	}
+
+	FVector Axis;
+	float Angle;
+	Delta.ToAxisAndAngle(Axis, Angle);
+	return Axis * (Angle / DeltaTime);
+}
+
+bool FHandMotionHistory::FindSpeedPeak(double SinceTime, float MinPeakSpeed, float DropRatio, FHandMotionSample& OutPeak) const
+{
+	if (Count < 2)
+	{
+		return false;
+	}
+
+	int32 PeakIndex = INDEX_NONE;
+	double PeakSpeedSq = FMath::Square(static_cast<double>(MinPeakSpeed));
+
+	for (int32 AgeIndex = 1; AgeIndex < Count; ++AgeIndex)
+	{
+		const FHandMotionSample& Sample = GetSample(AgeIndex);
+		if (Sample.Time < SinceTime)
+		{
+			break;
+		}
+
+		const double SpeedSq = Sample.Velocity.SizeSquared();
+		if (SpeedSq >= PeakSpeedSq)
+		{
+			PeakSpeedSq = SpeedSq;
+			PeakIndex = AgeIndex;
+		}
+	}
+
+	if (PeakIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// 最新速度必须已从峰值回落（比较平方）
+	const double NewestSpeedSq = GetSample(0).Velocity.SizeSquared();
+	if (NewestSpeedSq > PeakSpeedSq * FMath::Square(static_cast<double>(DropRatio)))
+	{
+		return false;
+	}
+
+	OutPeak = GetSample(PeakIndex);
+	return true;
+}
@@ -6,6 +6,8 @@
 #include "Grabber/IGrabbable.h"
 #include "Grabber/GrabTypes.h"
 #include "Grabbee/GrabbeeWeapon.h"
+#include "Grabbee/ArrowPoolSubsystem.h"
+#include "Grabber/DropPlacementSubsystem.h"
 
 UPCGrabHand::UPCGrabHand()
 {
@@ -87,7 +89,7 @@ void UPCGrabHand::TryGrab(bool bFromBackpack)
 		{
 			if (CachedInventory && CachedInventory->TryStoreArrow())
 			{
-				TargetActor->Destroy();
+				UArrowPoolSubsystem::ReturnToPoolOrDestroy(TargetActor);
 				return;
 			}
 			// 背包满则走正常抓取流程（不销毁）
@@ -204,6 +206,8 @@ void UPCGrabHand::DropToRaycastTarget()
 
 	// 丢弃时重新做一次射线检测：使用 Projectile 通道（比抓取通道更“广泛”）
 	FVector TargetLocation; // 显式在分支内赋值，避免静态分析误报
+	FHitResult Hit;
+	bool bHit = false;
 	if (PCPlayer->FirstPersonCamera)
 	{
 		const FVector Start = PCPlayer->FirstPersonCamera->GetComponentLocation();
@@ -213,8 +217,7 @@ void UPCGrabHand::DropToRaycastTarget()
 		QueryParams.AddIgnoredActor(PCPlayer);
 		QueryParams.AddIgnoredActor(DroppedObject);
 
-		FHitResult Hit;
-		const bool bHit = PCPlayer->GetWorld()->LineTraceSingleByChannel(Hit, Start, End, TCC_PROJECTILE, QueryParams);
+		bHit = PCPlayer->GetWorld()->LineTraceSingleByChannel(Hit, Start, End, TCC_PROJECTILE, QueryParams);
 		TargetLocation = bHit ? Hit.ImpactPoint : End;
 	}
 	else
@@ -230,7 +233,18 @@ void UPCGrabHand::DropToRaycastTarget()
 		return;
 	}
 
-	// 使用 Component Move + Sweep：命中则会停在碰撞外侧，避免瞬移穿透导致弹飞
+	// 优先交给放置服务：命中面朝上时直接放在命中点，否则投影到缓存的地面高度；一次空位检测后直接传送
+	if (UDropPlacementSubsystem* Placement = UDropPlacementSubsystem::Get(this))
+	{
+		FVector PlacedLocation;
+		if (Placement->PlaceComponent(DroppedPrimitive, TargetLocation, DroppedPrimitive->GetComponentQuat(), PlacedLocation,
+			bHit ? &Hit : nullptr))
+		{
+			return;
+		}
+	}
+
+	// 兜底：Component Move + Sweep：命中则会停在碰撞外侧，避免瞬移穿透导致弹飞
 	FHitResult SweepHit;
 	DroppedPrimitive->MoveComponent(
 		TargetLocation - DroppedPrimitive->GetComponentLocation(),
@@ -3,7 +3,10 @@
 #include "Grabber/PlayerGrabHand.h"
 #include "Game/InventoryComponent.h"
 #include "Grabber/IGrabbable.h"
+#include "Grabber/GrabConstraintDriverSubsystem.h"
+#include "Grabber/GrabHighlightSubsystem.h"
 #include "Grabbee/GrabbeeWeapon.h"
+#include "Grabbee/ArrowPoolSubsystem.h"
 #include "PhysicsEngine/PhysicsHandleComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Game/Characters/BasePlayer.h"
@@ -40,6 +43,12 @@ void UPlayerGrabHand::BeginPlay()
 		return;
 	}
 	// CachedPhysicsHandle 和 CachedInventory 将由 BasePlayer 在其 BeginPlay 中设置
+
+	// 抓取目标由驱动在物理步进前统一更新；没有驱动时退回自身 Tick
+	if (UGrabConstraintDriverSubsystem* Driver = UGrabConstraintDriverSubsystem::Get(this))
+	{
+		bGrabTargetDriven = Driver->RegisterHand(this);
+	}
 }
 
 void UPlayerGrabHand::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -47,6 +56,21 @@ void UPlayerGrabHand::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	// 确保释放 PhysicsHandle
 	ReleasePhysicsHandle();
 
+	if (bGrabTargetDriven)
+	{
+		if (UGrabConstraintDriverSubsystem* Driver = UGrabConstraintDriverSubsystem::Get(this))
+		{
+			Driver->UnregisterHand(this);
+		}
+		bGrabTargetDriven = false;
+	}
+
+	// 高亮按手计数：撤销这只手的全部高亮
+	if (UGrabHighlightSubsystem* Highlights = UGrabHighlightSubsystem::Get(this))
+	{
+		Highlights->RemoveAllHighlights(this);
+	}
+
 	// 清空缓存的组件引用
 	CachedPhysicsHandle = nullptr;
 	CachedInventory = nullptr;
@@ -58,30 +82,115 @@ void UPlayerGrabHand::TickComponent(float DeltaTime, ELevelTick TickType, FActor
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// 更新 PhysicsHandle 目标位置（如果正在抓取）
-	if (bIsHolding && HeldActor && CachedPhysicsHandle && CachedPhysicsHandle->GrabbedComponent)
+	if (bGrabTargetDriven)
 	{
-		// 根据缓存的抓取类型设置目标
-		switch (HeldGrabType)
-		{
-		case EGrabType::Free:
-		case EGrabType::WeaponSnap:
-			{
-				// 将局部偏移转换为世界空间
-				FTransform CurrentHandTransform = GetComponentTransform();
-				FVector TargetPosition = CurrentHandTransform.TransformPosition(GrabOffset.GetLocation());
-				FRotator TargetRotation = (CurrentHandTransform.GetRotation() * GrabOffset.GetRotation()).Rotator();
-				
-				CachedPhysicsHandle->SetTargetLocationAndRotation(TargetPosition, TargetRotation);
-			}
-			break;
-		case EGrabType::HumanBody:
-			// HumanBody: 直接跟随手部位置
-			CachedPhysicsHandle->SetTargetLocationAndRotation(GetComponentLocation(), GetComponentRotation());
-			break;
-		default:
-			break;
-		}
+		return;
+	}
+
+	// 没有驱动时：自行采样并更新 PhysicsHandle 目标位置（如果正在抓取）
+	UpdateHandMotion(DeltaTime);
+
+	FVector TargetLocation;
+	FRotator TargetRotation;
+	if (ComputeGrabTarget(TargetLocation, TargetRotation))
+	{
+		CachedPhysicsHandle->SetTargetLocationAndRotation(TargetLocation, TargetRotation);
+	}
+}
+
+// ==================== 抓取目标 ====================
+
+void UPlayerGrabHand::UpdateHandMotion(float DeltaTime)
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	bHasLatestHandTransform = false;
+
+	LastHandLocation = GetComponentLocation();
+	MotionHistory.AddSample(World->GetTimeSeconds(), LastHandLocation, GetComponentQuat(), MotionVelocityWindow);
+	MotionHistory.EstimateMotion(MotionVelocityWindow, HandVelocity, HandAcceleration);
+	HandAngularVelocity = MotionHistory.EstimateAngularVelocity(MotionVelocityWindow);
+	GrabPoseLeadTime = DeltaTime * GrabTargetPredictionScale;
+
+	OnHandMotionSampled.Broadcast(this);
+}
+
+bool UPlayerGrabHand::ComputeGrabTarget(FVector& OutLocation, FRotator& OutRotation) const
+{
+	if (!bIsHolding || !HeldActor || !CachedPhysicsHandle || !CachedPhysicsHandle->GrabbedComponent)
+	{
+		return false;
+	}
+
+	const FTransform HandTransform = GetPredictedHandTransform();
+
+	// 双手抓取：由两只手合成一个目标
+	const UPlayerGrabHand* Partner = TwoHandPartner.Get();
+	if (Partner && TwoHandSolver.IsValid() && Partner->HeldActor == HeldActor)
+	{
+		FQuat TargetRotation;
+		TwoHandSolver.Solve(HandTransform, Partner->GetPredictedHandTransform(), OutLocation, TargetRotation);
+		OutRotation = TargetRotation.Rotator();
+		return true;
+	}
+
+	// 副手抓住另一物理体：目标取自主手的同一次求解
+	if (bTwoHandSecondary && Partner && Partner->TwoHandSolver.IsValid() && Partner->TwoHandSolver.HasSecondaryTarget() &&
+		Partner->HeldActor == HeldActor)
+	{
+		FVector PrimaryLocation;
+		FQuat PrimaryRotation;
+		Partner->TwoHandSolver.Solve(Partner->GetPredictedHandTransform(), HandTransform, PrimaryLocation, PrimaryRotation);
+		const FTransform SecondaryTarget = Partner->TwoHandSolver.GetSecondaryTarget(PrimaryLocation, PrimaryRotation);
+		OutLocation = SecondaryTarget.GetLocation();
+		OutRotation = SecondaryTarget.Rotator();
+		return true;
+	}
+
+	return ComputeSingleHandTarget(HandTransform, OutLocation, OutRotation);
+}
+
+void UPlayerGrabHand::SetLatestHandTransform(const FTransform& InTransform)
+{
+	LatestHandTransform = InTransform;
+	bHasLatestHandTransform = true;
+}
+
+FTransform UPlayerGrabHand::GetPredictedHandTransform() const
+{
+	FQuat HandRotation = bHasLatestHandTransform ? LatestHandTransform.GetRotation() : GetComponentQuat();
+	const FVector HandLocation = bHasLatestHandTransform ? LatestHandTransform.GetLocation() : GetComponentLocation();
+
+	const float AngularSpeed = HandAngularVelocity.Size();
+	if (AngularSpeed > KINDA_SMALL_NUMBER)
+	{
+		HandRotation = FQuat(HandAngularVelocity / AngularSpeed, AngularSpeed * GrabPoseLeadTime) * HandRotation;
+	}
+	return FTransform(HandRotation, HandLocation + HandVelocity * GrabPoseLeadTime);
+}
+
+bool UPlayerGrabHand::ComputeSingleHandTarget(const FTransform& HandTransform, FVector& OutLocation, FRotator& OutRotation) const
+{
+	// 根据缓存的抓取类型设置目标
+	switch (HeldGrabType)
+	{
+	case EGrabType::Free:
+	case EGrabType::WeaponSnap:
+		// 将局部偏移转换为世界空间
+		OutLocation = HandTransform.TransformPosition(GrabOffset.GetLocation());
+		OutRotation = (HandTransform.GetRotation() * GrabOffset.GetRotation()).Rotator();
+		return true;
+	case EGrabType::HumanBody:
+		// HumanBody: 直接跟随手部位置
+		OutLocation = HandTransform.GetLocation();
+		OutRotation = HandTransform.Rotator();
+		return true;
+	default:
+		return false;
 	}
 }
 
@@ -137,14 +246,14 @@ void UPlayerGrabHand::TryRelease(bool bToBackpack)
 			{
 				if (CachedInventory && CachedInventory->TryStoreArrow())
 				{
-					// 保存指针用于销毁
+					// 保存指针用于回收
 					AActor* ArrowToDestroy = HeldActor;
 					
 					// 统一通过 ReleaseObject 释放（处理物理控制、状态清理、回调）
 					ReleaseObject();
 					
-					// 销毁箭 Actor
-					ArrowToDestroy->Destroy();
+					// 箭 Actor 回到对象池
+					UArrowPoolSubsystem::ReturnToPoolOrDestroy(ArrowToDestroy);
 					return;
 				}
 			}
@@ -324,31 +433,25 @@ void UPlayerGrabHand::GrabObject(AActor* TargetActor, FName BoneName)
 	// ==================== 共同逻辑：配置 PhysicsHandle 并执行抓取 ====================
 	if (GrabType != EGrabType::Custom)
 	{
-		// 配置 PhysicsHandle 参数
-		if (bUseSnapStrength)
+		// 另一只手已用约束抓住同一 Actor：由主手统一求解双手目标，抓住部位的质量决定谁主导
+		// - 同一物理体（同一组件的同一骨骼）：不再加第二个约束
+		// - 不同物理体（布娃娃的两根骨骼）：各自保留约束，副手约束的目标也由同一求解得出
+		const bool bJoinTwoHandGrab = bUseTwoHandSolver && bSupportsDual &&
+			(GrabType == EGrabType::Free || GrabType == EGrabType::HumanBody) &&
+			OtherHand && OtherHand->bIsHolding && OtherHand->HeldActor == TargetActor && !OtherHand->bTwoHandSecondary &&
+			OtherHand->CachedPhysicsHandle && OtherHand->CachedPhysicsHandle->GrabbedComponent;
+		const bool bSameBody = bJoinTwoHandGrab &&
+			OtherHand->CachedPhysicsHandle->GrabbedComponent == Primitive &&
+			OtherHand->CachedPhysicsHandle->GrabbedBoneName == GrabBoneName;
+
+		if (!bSameBody)
 		{
-			CachedPhysicsHandle->LinearDamping = WeaponSnapLinearDamping;
-			CachedPhysicsHandle->LinearStiffness = WeaponSnapLinearStiffness;
-			CachedPhysicsHandle->AngularDamping = WeaponSnapAngularDamping;
-			CachedPhysicsHandle->AngularStiffness = WeaponSnapAngularStiffness;
-			CachedPhysicsHandle->InterpolationSpeed = 100.0f;
+			BeginPhysicsGrab(Primitive, GrabBoneName, GrabLocation, GrabRotation, bUseSnapStrength);
 		}
-		else
+		if (bJoinTwoHandGrab)
 		{
-			CachedPhysicsHandle->LinearDamping = FreeGrabLinearDamping;
-			CachedPhysicsHandle->LinearStiffness = FreeGrabLinearStiffness;
-			CachedPhysicsHandle->AngularDamping = FreeGrabAngularDamping;
-			CachedPhysicsHandle->AngularStiffness = FreeGrabAngularStiffness;
-			CachedPhysicsHandle->InterpolationSpeed = 50.0f;
+			OtherHand->BeginTwoHandGrab(this, GetGrabbedBodyMass(Primitive, GrabBoneName));
 		}
-
-		// 执行抓取
-		CachedPhysicsHandle->GrabComponentAtLocationWithRotation(
-			Primitive,
-			GrabBoneName,
-			GrabLocation,
-			GrabRotation
-		);
 	}
 
 	// 更新状态
@@ -372,6 +475,19 @@ void UPlayerGrabHand::ReleaseObject()
 	AActor* ReleasedActor = HeldActor;
 	EGrabType GrabType = HeldGrabType;
 
+	// 双手抓取：主手松开时副手接管约束
+	UPlayerGrabHand* TwoHandHeir = nullptr;
+	if (UPlayerGrabHand* Partner = TwoHandPartner.Get())
+	{
+		// 副手没有自己的约束（同一物理体）时才需要接管；抓另一物理体的副手继续用自己的约束
+		if (!bTwoHandSecondary && Partner->HeldActor == ReleasedActor &&
+			Partner->CachedPhysicsHandle && !Partner->CachedPhysicsHandle->GrabbedComponent)
+		{
+			TwoHandHeir = Partner;
+		}
+		EndTwoHandGrab();
+	}
+
 	// 根据抓取类型执行释放
 	switch (GrabType)
 	{
@@ -387,6 +503,11 @@ void UPlayerGrabHand::ReleaseObject()
 		break;
 	}
 
+	if (TwoHandHeir)
+	{
+		TwoHandHeir->RegrabWithOwnPhysicsHandle();
+	}
+
 	// 通知物体被释放（通过接口）
 	if (ReleasedActor && ReleasedActor->GetClass()->ImplementsInterface(UGrabbable::StaticClass()))
 	{
@@ -406,6 +527,14 @@ void UPlayerGrabHand::ReleaseObject()
 void UPlayerGrabHand::SetPhysicsHandle(UPhysicsHandleComponent* InPhysicsHandle)
 {
 	CachedPhysicsHandle = InPhysicsHandle;
+
+	if (bGrabTargetDriven)
+	{
+		if (UGrabConstraintDriverSubsystem* Driver = UGrabConstraintDriverSubsystem::Get(this))
+		{
+			Driver->RefreshHandPrerequisites(this);
+		}
+	}
 }
 
 void UPlayerGrabHand::SetInventory(UInventoryComponent* InInventory)
@@ -429,6 +558,131 @@ void UPlayerGrabHand::ReleasePhysicsHandle()
 	}
 }
 
+void UPlayerGrabHand::BeginPhysicsGrab(UPrimitiveComponent* Primitive, FName BoneName, const FVector& GrabLocation, const FRotator& GrabRotation, bool bUseSnapStrength)
+{
+	if (!CachedPhysicsHandle || !Primitive)
+	{
+		return;
+	}
+
+	// 配置 PhysicsHandle 参数
+	if (bUseSnapStrength)
+	{
+		CachedPhysicsHandle->LinearDamping = WeaponSnapLinearDamping;
+		CachedPhysicsHandle->LinearStiffness = WeaponSnapLinearStiffness;
+		CachedPhysicsHandle->AngularDamping = WeaponSnapAngularDamping;
+		CachedPhysicsHandle->AngularStiffness = WeaponSnapAngularStiffness;
+		CachedPhysicsHandle->InterpolationSpeed = 100.0f;
+	}
+	else
+	{
+		CachedPhysicsHandle->LinearDamping = FreeGrabLinearDamping;
+		CachedPhysicsHandle->LinearStiffness = FreeGrabLinearStiffness;
+		CachedPhysicsHandle->AngularDamping = FreeGrabAngularDamping;
+		CachedPhysicsHandle->AngularStiffness = FreeGrabAngularStiffness;
+		CachedPhysicsHandle->InterpolationSpeed = 50.0f;
+	}
+
+	// 执行抓取
+	CachedPhysicsHandle->GrabComponentAtLocationWithRotation(
+		Primitive,
+		BoneName,
+		GrabLocation,
+		GrabRotation
+	);
+}
+
+// ==================== 双手抓取 ====================
+
+void UPlayerGrabHand::BeginTwoHandGrab(UPlayerGrabHand* Secondary, float SecondaryWeight)
+{
+	if (!Secondary || !CachedPhysicsHandle || !CachedPhysicsHandle->GrabbedComponent)
+	{
+		return;
+	}
+
+	// 以当前单手目标为约束坐标系，记录两只手的相对位置
+	FVector TargetLocation;
+	FRotator TargetRotation;
+	if (!ComputeSingleHandTarget(GetComponentTransform(), TargetLocation, TargetRotation))
+	{
+		return;
+	}
+
+	// 副手已用自己的约束抓住另一物理体：记录它的单手目标，之后由合成目标推出
+	FVector SecondaryLocation;
+	FRotator SecondaryRotation;
+	const bool bSecondaryOwnsConstraint = Secondary->CachedPhysicsHandle && Secondary->CachedPhysicsHandle->GrabbedComponent &&
+		Secondary->ComputeSingleHandTarget(Secondary->GetComponentTransform(), SecondaryLocation, SecondaryRotation);
+	const FTransform SecondaryTarget(SecondaryRotation, SecondaryLocation);
+
+	const float PrimaryWeight = GetGrabbedBodyMass(CachedPhysicsHandle->GrabbedComponent, CachedPhysicsHandle->GrabbedBoneName);
+	TwoHandSolver.Initialize(FTransform(TargetRotation, TargetLocation), GetComponentTransform(), Secondary->GetComponentTransform(),
+		PrimaryWeight, SecondaryWeight, bSecondaryOwnsConstraint ? &SecondaryTarget : nullptr);
+
+	TwoHandPartner = Secondary;
+	bTwoHandSecondary = false;
+	Secondary->TwoHandPartner = this;
+	Secondary->bTwoHandSecondary = true;
+	Secondary->TwoHandSolver.Reset();
+}
+
+void UPlayerGrabHand::EndTwoHandGrab()
+{
+	if (UPlayerGrabHand* Partner = TwoHandPartner.Get())
+	{
+		Partner->TwoHandPartner.Reset();
+		Partner->bTwoHandSecondary = false;
+		Partner->TwoHandSolver.Reset();
+	}
+
+	TwoHandPartner.Reset();
+	bTwoHandSecondary = false;
+	TwoHandSolver.Reset();
+}
+
+void UPlayerGrabHand::RegrabWithOwnPhysicsHandle()
+{
+	if (!bIsHolding || !HeldActor || !CachedPhysicsHandle)
+	{
+		return;
+	}
+
+	UPrimitiveComponent* Primitive = IGrabbable::Execute_GetGrabPrimitive(HeldActor);
+	if (!Primitive)
+	{
+		return;
+	}
+
+	switch (HeldGrabType)
+	{
+	case EGrabType::Free:
+		{
+			// 与 GrabObject 相同：抓质心，偏移相对于手
+			const FTransform HandTransform = GetComponentTransform();
+			const FVector GrabLocation = Primitive->GetCenterOfMass();
+			const FQuat GrabRotation = HeldActor->GetActorQuat();
+			GrabOffset = FTransform(HandTransform.GetRotation().Inverse() * GrabRotation, HandTransform.InverseTransformPosition(GrabLocation), FVector::OneVector);
+			BeginPhysicsGrab(Primitive, NAME_None, GrabLocation, GrabRotation.Rotator(), false);
+		}
+		break;
+	case EGrabType::HumanBody:
+		BeginPhysicsGrab(Primitive, GrabbedBoneName, Primitive->GetCenterOfMass(GrabbedBoneName), GetComponentRotation(), false);
+		break;
+	default:
+		break;
+	}
+}
+
+float UPlayerGrabHand::GetGrabbedBodyMass(UPrimitiveComponent* Primitive, FName BoneName)
+{
+	if (const FBodyInstance* Body = Primitive ? Primitive->GetBodyInstance(BoneName) : nullptr)
+	{
+		return FMath::Max(Body->GetBodyMass(), KINDA_SMALL_NUMBER);
+	}
+	return 1.0f;
+}
+
 // ==================== 辅助函数 ====================
 
 void UPlayerGrabHand::HandleOtherHandHolding(AActor* TargetActor, IGrabbable* Grabbable)
@@ -0,0 +1,58 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Grabber/TwoHandGrabSolver.h"
+
+namespace TwoHandGrab
+{
+	/** 两手距离小于该值时，连线方向不可靠 */
+	constexpr float MinAxisLength = 5.0f;
+}
+
+void FTwoHandGrabSolver::Initialize(const FTransform& ConstraintTarget, const FTransform& PrimaryHand, const FTransform& SecondaryHand,
+	float PrimaryWeight, float SecondaryWeight, const FTransform* SecondaryConstraintTarget)
+{
+	const FQuat TargetRotation = ConstraintTarget.GetRotation();
+	const FQuat InvTargetRotation = TargetRotation.Inverse();
+
+	PrimaryLocal = InvTargetRotation.RotateVector(PrimaryHand.GetLocation() - ConstraintTarget.GetLocation());
+	SecondaryLocal = InvTargetRotation.RotateVector(SecondaryHand.GetLocation() - ConstraintTarget.GetLocation());
+	PrimaryToTarget = PrimaryHand.GetRotation().Inverse() * TargetRotation;
+
+	const float TotalWeight = FMath::Max(PrimaryWeight, 0.0f) + FMath::Max(SecondaryWeight, 0.0f);
+	PrimaryAlpha = TotalWeight > KINDA_SMALL_NUMBER ? FMath::Max(PrimaryWeight, 0.0f) / TotalWeight : 0.5f;
+
+	bHasAxis = FVector::DistSquared(PrimaryLocal, SecondaryLocal) > FMath::Square(TwoHandGrab::MinAxisLength);
+
+	bHasSecondaryTarget = SecondaryConstraintTarget != nullptr;
+	SecondaryTargetRelative = bHasSecondaryTarget
+		? SecondaryConstraintTarget->GetRelativeTransform(FTransform(TargetRotation, ConstraintTarget.GetLocation()))
+		: FTransform::Identity;
+	bValid = true;
+}
+
+void FTwoHandGrabSolver::Solve(const FTransform& PrimaryHand, const FTransform& SecondaryHand, FVector& OutLocation, FQuat& OutRotation) const
+{
+	// 1) 旋转先跟随主手
+	FQuat Rotation = PrimaryHand.GetRotation() * PrimaryToTarget;
+
+	// 2) 把物体上的“主手→副手”轴摆到当前两手连线方向（只做最小摆动，扭转仍由主手决定）
+	const FVector HandAxis = SecondaryHand.GetLocation() - PrimaryHand.GetLocation();
+	if (bHasAxis && HandAxis.SizeSquared() > FMath::Square(TwoHandGrab::MinAxisLength))
+	{
+		const FVector CurrentAxis = Rotation.RotateVector(SecondaryLocal - PrimaryLocal).GetSafeNormal();
+		Rotation = FQuat::FindBetweenNormals(CurrentAxis, HandAxis.GetSafeNormal()) * Rotation;
+	}
+	Rotation.Normalize();
+
+	// 3) 位置：两个手柄要求的约束位置加权平均
+	const FVector FromPrimary = PrimaryHand.GetLocation() - Rotation.RotateVector(PrimaryLocal);
+	const FVector FromSecondary = SecondaryHand.GetLocation() - Rotation.RotateVector(SecondaryLocal);
+
+	OutLocation = FMath::Lerp(FromSecondary, FromPrimary, PrimaryAlpha);
+	OutRotation = Rotation;
+}
+
+FTransform FTwoHandGrabSolver::GetSecondaryTarget(const FVector& Location, const FQuat& Rotation) const
+{
+	return SecondaryTargetRelative * FTransform(Rotation, Location);
+}
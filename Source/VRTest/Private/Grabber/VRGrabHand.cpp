@@ -4,10 +4,10 @@
 
 #include "Audio/AudioSubsystem.h"
 #include "Grabber/IGrabbable.h"
+#include "Grabber/GrabbableRegistrySubsystem.h"
 #include "Grabbee/GrabbeeObject.h"
 #include "Grabbee/GrabbeeWeapon.h"
 #include "Components/SkeletalMeshComponent.h"
-#include "Game/GameUtils.h"
 #include "Game/CollisionConfig.h"
 #include "Game/MyGameplayTags.h"
 
@@ -19,12 +19,29 @@ UVRGrabHand::UVRGrabHand()
 void UVRGrabHand::BeginPlay()
 {
 	Super::BeginPlay();
-	LastHandLocation = GetComponentLocation();
-	
+
 	if (!HandCollision)
 	{
 		UE_LOG(LogTemp, Error, TEXT("VRGrabHand::BeginPlay - HandCollision is NULL!"));
 	}
+
+	// 加入注册表的批量查询（两只手同一帧只遍历一次）
+	CachedGrabbableRegistry = UGrabbableRegistrySubsystem::Get(this);
+	if (CachedGrabbableRegistry)
+	{
+		CachedGrabbableRegistry->RegisterHand(this);
+	}
+}
+
+void UVRGrabHand::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (CachedGrabbableRegistry)
+	{
+		CachedGrabbableRegistry->UnregisterHand(this);
+		CachedGrabbableRegistry = nullptr;
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UVRGrabHand::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -132,80 +149,45 @@ void UVRGrabHand::TryRelease(bool bToBackpack)
 	Super::TryRelease(bToBackpack);
 }
 
-// ==================== VR 专用接口 ====================
-
-AActor* UVRGrabHand::FindAngleClosestTarget()
+bool UVRGrabHand::SetBodyZone(EVRBodyZone NewZone)
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	if (NewZone == CurrentBodyZone)
 	{
-		return nullptr;
+		return false;
 	}
 
-	const FVector Origin = GetComponentLocation();
-	const FVector Forward = GetForwardVector().GetSafeNormal();
+	const EVRBodyZone OldZone = CurrentBodyZone;
+	CurrentBodyZone = NewZone;
+	bIsInBackpackArea = VRBodyZone::IsArrowStorage(NewZone);
 
-	TArray<FOverlapResult> Overlaps;
-	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(VRGravityGloves), false);
-	QueryParams.AddIgnoredActor(GetOwner());
+	OnBodyZoneChanged.Broadcast(NewZone, OldZone);
+	return true;
+}
 
-	const bool bHit = World->OverlapMultiByChannel(
-		Overlaps,
-		Origin,
-		FQuat::Identity,
-		TCC_GRAB,
-		FCollisionShape::MakeSphere(GravityGlovesDistance),
-		QueryParams
-	);
+// ==================== VR 专用接口 ====================
 
-	if (!bHit || Overlaps.Num() == 0)
+AActor* UVRGrabHand::FindAngleClosestTarget(float* OutCosAngle)
+{
+	const FGrabbableQueryResult* Result = CachedGrabbableRegistry ? CachedGrabbableRegistry->GetHandQueryResult(this) : nullptr;
+	if (!Result)
 	{
 		return nullptr;
 	}
 
-	TArray<FActorWithAngle> Candidates;
-	TSet<AActor*> VisitedActors;
-
-	for (const FOverlapResult& Overlap : Overlaps)
+	// 候选已按夹角从小到大排好，且注册表已做过 CanBeGrabbedBy/CanBeGrabbedByGravityGlove 判断
+	for (int32 Index = 0; Index < Result->ConeCandidates.Num(); ++Index)
 	{
-		AActor* Actor = Overlap.GetActor();
-		if (!Actor || VisitedActors.Contains(Actor))
-		{
-			continue;
-		}
-		VisitedActors.Add(Actor);
-
-		if (!Actor->GetClass()->ImplementsInterface(UGrabbable::StaticClass()))
+		AActor* Actor = Result->ConeCandidates[Index];
+		if (!IsValid(Actor))
 		{
 			continue;
 		}
 
-		if (!IGrabbable::Execute_CanBeGrabbedByGravityGlove(Actor))
+		if (OutCosAngle)
 		{
-			continue;
-		}
-
-		if (!IGrabbable::Execute_CanBeGrabbedBy(Actor, this))
-		{
-			continue;
+			*OutCosAngle = Result->ConeCosAngles[Index];
 		}
-
-		const FVector ToTarget = (Actor->GetActorLocation() - Origin).GetSafeNormal();
-		const float Angle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Forward, ToTarget)));
-		if (Angle <= GravityGlovesAngle)
-		{
-			Candidates.Add(FActorWithAngle(Actor, Angle));
-		}
-	}
-
-	Candidates.Sort([](const FActorWithAngle& A, const FActorWithAngle& B)
-	{
-		return A.Angle < B.Angle;
-	});
-
-	if (Candidates.Num() > 0)
-	{
-		return Candidates[0].Actor;
+		return Actor;
 	}
 
 	return nullptr;
@@ -235,15 +217,12 @@ void UVRGrabHand::VirtualGrab(AActor* Target)
 	bIsHolding = true;
 	bIsVirtualGrabbing = true;
 
-	// 重置手部速度追踪，避免残留数据触发误判
-	LastHandLocation = GetComponentLocation();
-	HandVelocity = FVector::ZeroVector;
-
 	// 清除选中状态（物体从"选中"变为"虚拟抓取"）
 	if (GravityGlovesTarget == Target)
 	{
 		GravityGlovesTarget = nullptr;
 	}
+	PendingGravityGlovesTarget = nullptr;
 
 	// 通知物体被选中变为抓取（但不是真正的物理抓取）
 	// 不调用 OnGrabbed，因为物体还没到手
@@ -272,7 +251,7 @@ void UVRGrabHand::VirtualRelease(bool bLaunch)
 	// 通知物体取消选中（虚拟抓取结束）
 	if (IGrabbable* Grabbable = Cast<IGrabbable>(ReleasedTarget))
 	{
-		IGrabbable::Execute_OnGrabDeselected(ReleasedTarget);
+		IGrabbable::Execute_OnGrabDeselected(ReleasedTarget, this);
 	}
 
 	// 清除状态
@@ -296,9 +275,6 @@ void UVRGrabHand::UpdateGravityGloves(float DeltaTime)
 			return;
 		}
 
-		// 只在虚拟抓取时追踪手部速度（用于后拉手势检测）
-		UpdateHandVelocity(DeltaTime);
-
 		// 检测向后拉动手势
 		if (CheckPullBackGesture())
 		{
@@ -311,41 +287,118 @@ void UVRGrabHand::UpdateGravityGloves(float DeltaTime)
 	// 如果没有抓取物体，寻找新的目标
 	if (!bIsHolding)
 	{
-		AActor* NewTarget = FindAngleClosestTarget();
-
-		// 目标发生变化
-		if (NewTarget != GravityGlovesTarget)
+		// 两次扫描之间：只检查当前目标是否还在保持角内
+		if (!ShouldScanGravityGloves())
 		{
-			// 取消选中旧目标（通过接口）
-			if (GravityGlovesTarget)
+			if (GravityGlovesTarget && (!IsValid(GravityGlovesTarget) ||
+				GetGravityGlovesAimCos(GravityGlovesTarget) < FMath::Cos(FMath::DegreesToRadians(GravityGlovesKeepAngle))))
 			{
-				if (IGrabbable* OldGrabbable = Cast<IGrabbable>(GravityGlovesTarget))
-				{
-					IGrabbable::Execute_OnGrabDeselected(GravityGlovesTarget);
-				}
+				SetGravityGlovesTarget(nullptr);
 			}
+			return;
+		}
 
-			// 选中新目标（通过接口）
-			GravityGlovesTarget = NewTarget;
-			if (GravityGlovesTarget)
-			{
-				if (IGrabbable* NewGrabbable = Cast<IGrabbable>(GravityGlovesTarget))
-				{
-					IGrabbable::Execute_OnGrabSelected(GravityGlovesTarget);
-				}
-			}
+		SetGravityGlovesTarget(SelectGravityGlovesTarget());
+	}
+}
+
+bool UVRGrabHand::ShouldScanGravityGloves()
+{
+	const UWorld* World = GetWorld();
+	const float Now = World ? World->GetTimeSeconds() : 0.0f;
+
+	if (GravityGlovesScanRate > 0.0f)
+	{
+		const int64 Bucket = FMath::FloorToInt64(Now * GravityGlovesScanRate);
+		if (Bucket == LastScanBucket)
+		{
+			return false;
 		}
+		LastScanBucket = Bucket;
 	}
+
+	return true;
 }
 
-void UVRGrabHand::UpdateHandVelocity(float DeltaTime)
+AActor* UVRGrabHand::SelectGravityGlovesTarget()
 {
-	if (DeltaTime > 0.0f)
+	float BestCos = -1.0f;
+	AActor* BestTarget = FindAngleClosestTarget(&BestCos);
+
+	AActor* CurrentTarget = GravityGlovesTarget;
+	if (!CurrentTarget || !IsGravityGlovesTargetStillValid(CurrentTarget))
 	{
-		FVector CurrentLocation = GetComponentLocation();
-		HandVelocity = (CurrentLocation - LastHandLocation) / DeltaTime;
-		LastHandLocation = CurrentLocation;
+		PendingGravityGlovesTarget = nullptr;
+		return BestTarget;
 	}
+
+	// 当前目标离开保持角：直接换成最佳候选（可能为空）
+	const float CurrentCos = GetGravityGlovesAimCos(CurrentTarget);
+	if (CurrentCos < FMath::Cos(FMath::DegreesToRadians(GravityGlovesKeepAngle)))
+	{
+		PendingGravityGlovesTarget = nullptr;
+		return BestTarget;
+	}
+
+	if (!BestTarget || BestTarget == CurrentTarget || BestCos <= CurrentCos + GravityGlovesSwitchMargin)
+	{
+		PendingGravityGlovesTarget = nullptr;
+		return CurrentTarget;
+	}
+
+	// 新候选明显更好：需要持续领先 SwitchDelay 才切换
+	const UWorld* World = GetWorld();
+	const float Now = World ? World->GetTimeSeconds() : 0.0f;
+	if (PendingGravityGlovesTarget != BestTarget)
+	{
+		PendingGravityGlovesTarget = BestTarget;
+		PendingGravityGlovesTargetTime = Now;
+		return CurrentTarget;
+	}
+
+	if (Now - PendingGravityGlovesTargetTime >= GravityGlovesSwitchDelay)
+	{
+		PendingGravityGlovesTarget = nullptr;
+		return BestTarget;
+	}
+
+	return CurrentTarget;
+}
+
+void UVRGrabHand::SetGravityGlovesTarget(AActor* NewTarget)
+{
+	if (NewTarget == GravityGlovesTarget)
+	{
+		return;
+	}
+
+	// 取消选中旧目标（通过接口）
+	if (IsValid(GravityGlovesTarget))
+	{
+		IGrabbable::Execute_OnGrabDeselected(GravityGlovesTarget, this);
+	}
+
+	// 选中新目标（通过接口）
+	GravityGlovesTarget = NewTarget;
+	if (GravityGlovesTarget)
+	{
+		IGrabbable::Execute_OnGrabSelected(GravityGlovesTarget, this);
+	}
+}
+
+float UVRGrabHand::GetGravityGlovesAimCos(AActor* Target) const
+{
+	const UPrimitiveComponent* GrabPrimitive = IGrabbable::Execute_GetGrabPrimitive(Target);
+	const FVector TargetLocation = GrabPrimitive ? GrabPrimitive->Bounds.Origin : Target->GetActorLocation();
+	const FVector ToTarget = (TargetLocation - GetComponentLocation()).GetSafeNormal();
+	return FVector::DotProduct(GetForwardVector(), ToTarget);
+}
+
+bool UVRGrabHand::IsGravityGlovesTargetStillValid(AActor* Target) const
+{
+	return IsValid(Target) && !Target->IsHidden() &&
+		IGrabbable::Execute_CanBeGrabbedByGravityGlove(Target) &&
+		IGrabbable::Execute_CanBeGrabbedBy(Target, this);
 }
 
 bool UVRGrabHand::CheckPullBackGesture() const
@@ -376,71 +429,92 @@ bool UVRGrabHand::IsInGravityGlovesAngle(AActor* Target) const
 
 	FVector HandForward = GetForwardVector();
 	FVector ToTarget = (Target->GetActorLocation() - GetComponentLocation()).GetSafeNormal();
-	float Angle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(HandForward, ToTarget)));
 
-	return Angle <= GravityGlovesAngle;
+	// 比较余弦，避免 Acos
+	return FVector::DotProduct(HandForward, ToTarget) >= FMath::Cos(FMath::DegreesToRadians(GravityGlovesAngle));
 }
 
-AActor* UVRGrabHand::PerformSphereTrace(FName& OutBoneName) const
+FGrabbableQuery UVRGrabHand::BuildGrabbableQuery() const
 {
-	OutBoneName = NAME_None;
+	FGrabbableQuery Query;
+	Query.Origin = GetComponentLocation();
+	Query.NearOrigin = Query.Origin;
+	Query.Forward = GetForwardVector().GetSafeNormal();
 
-	UWorld* World = GetWorld();
-	if (!World)
+	// 锥形结果要用到下一次扫描：用运动历史估计的手部速度把位姿外推半个扫描间隔
+	// 近距离查询不外推：直接抓取每帧都用当前位置做精确判断，外推会漏掉手边的物体
+	if (GravityGlovesScanRate > 0.0f)
 	{
-		return nullptr;
+		const float Lead = 0.5f / GravityGlovesScanRate;
+		Query.Origin += HandVelocity * Lead;
+
+		const float AngularSpeed = HandAngularVelocity.Size();
+		if (AngularSpeed > KINDA_SMALL_NUMBER)
+		{
+			const FQuat PredictedTurn(HandAngularVelocity / AngularSpeed, AngularSpeed * Lead);
+			Query.Forward = PredictedTurn.RotateVector(Query.Forward).GetSafeNormal();
+		}
 	}
 
-	const FVector Origin = GetComponentLocation();
-	TArray<FOverlapResult> Overlaps;
-	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(VRGrabOverlap), false);
-	QueryParams.AddIgnoredActor(GetOwner());
+	Query.NearRadius = GrabSphereRadius;
+	Query.IgnoreActor = GetOwner();
+	Query.Hand = this;
 
-	const bool bHit = World->OverlapMultiByChannel(
-		Overlaps,
-		Origin,
-		FQuat::Identity,
-		TCC_GRAB,
-		FCollisionShape::MakeSphere(GrabSphereRadius),
-		QueryParams
-	);
+	// 手里有东西时不需要找远程目标
+	if (!bIsHolding)
+	{
+		Query.ConeDistance = GravityGlovesDistance;
+		Query.ConeCosAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(GravityGlovesAngle, 0.0f, 90.0f)));
+	}
+
+	return Query;
+}
+
+AActor* UVRGrabHand::PerformSphereTrace(FName& OutBoneName) const
+{
+	OutBoneName = NAME_None;
 
-	if (!bHit || Overlaps.Num() == 0)
+	const FGrabbableQueryResult* Result = CachedGrabbableRegistry ? CachedGrabbableRegistry->GetHandQueryResult(this) : nullptr;
+	if (!Result || Result->NearCandidates.Num() == 0)
 	{
 		return nullptr;
 	}
 
+	const FVector Origin = GetComponentLocation();
+
 	AActor* ClosestGrabbableActor = nullptr;
-	float ClosestDistanceSq = FLT_MAX;
+	float ClosestDistance = FLT_MAX;
 	FName ClosestBoneName = NAME_None;
-	TSet<AActor*> VisitedActors;
 
-	for (const FOverlapResult& Overlap : Overlaps)
+	// 注册表只按包围球筛选，这里对少量候选做精确的碰撞体距离判断（不做场景 Overlap）
+	for (AActor* HitActor : Result->NearCandidates)
 	{
-		AActor* HitActor = Overlap.GetActor();
-		if (!HitActor || VisitedActors.Contains(HitActor))
-		{
-			continue;
-		}
-		VisitedActors.Add(HitActor);
-
-		IGrabbable* Grabbable = Cast<IGrabbable>(HitActor);
-		if (!Grabbable)
+		// CanBeGrabbedBy 已在注册表遍历中判断
+		if (!IsValid(HitActor))
 		{
 			continue;
 		}
 
-		if (!IGrabbable::Execute_CanBeGrabbedBy(HitActor, this))
+		const UPrimitiveComponent* HitComp = IGrabbable::Execute_GetGrabPrimitive(HitActor);
+		float Distance = HitComp ? FVector::Dist(Origin, HitComp->GetComponentLocation()) : FVector::Dist(Origin, HitActor->GetActorLocation());
+		if (HitComp)
 		{
-			continue;
+			FVector ClosestPoint;
+			const float CollisionDistance = HitComp->GetClosestPointOnCollision(Origin, ClosestPoint);
+			if (CollisionDistance > GrabSphereRadius)
+			{
+				continue;
+			}
+			// 没有碰撞体数据时（返回 < 0）沿用包围球结果
+			if (CollisionDistance >= 0.0f)
+			{
+				Distance = CollisionDistance;
+			}
 		}
 
-		const UPrimitiveComponent* HitComp = Overlap.Component.Get();
-		const FVector TargetLocation = HitComp ? HitComp->GetComponentLocation() : HitActor->GetActorLocation();
-		const float DistanceSq = FVector::DistSquared(Origin, TargetLocation);
-		if (DistanceSq < ClosestDistanceSq)
+		if (Distance < ClosestDistance)
 		{
-			ClosestDistanceSq = DistanceSq;
+			ClosestDistance = Distance;
 			ClosestGrabbableActor = HitActor;
 			ClosestBoneName = NAME_None;
 
@@ -459,4 +533,3 @@ AActor* UVRGrabHand::PerformSphereTrace(FName& OutBoneName) const
 
 	return nullptr;
 }
-
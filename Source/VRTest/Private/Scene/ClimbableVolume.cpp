@@ -5,8 +5,11 @@
 #include "Components/BoxComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Game/Characters/BasePlayer.h"
+#include "Game/Characters/BasePCPlayer.h"
 #include "Game/CollisionConfig.h"
 #include "Grabber/PlayerGrabHand.h"
+#include "Grabber/GrabbableRegistrySubsystem.h"
+#include "Engine/World.h"
 
 AClimbableVolume::AClimbableVolume()
 {
@@ -29,6 +32,13 @@ AClimbableVolume::AClimbableVolume()
 void AClimbableVolume::BeginPlay()
 {
 	Super::BeginPlay();
+	UGrabbableRegistrySubsystem::RegisterGrabbable(this);
+}
+
+void AClimbableVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UGrabbableRegistrySubsystem::UnregisterGrabbable(this);
+	Super::EndPlay(EndPlayReason);
 }
 
 EGrabType AClimbableVolume::GetGrabType_Implementation() const
@@ -48,7 +58,20 @@ bool AClimbableVolume::CanBeGrabbedBy_Implementation(const UPlayerGrabHand* Hand
 		return false;
 	}
 
-	return Cast<ABasePlayer>(Hand->GetOwner()) != nullptr;
+	if (Cast<ABasePlayer>(Hand->GetOwner()) == nullptr)
+	{
+		return false;
+	}
+
+	// 有烘焙数据时只允许在抓点附近抓取（查表，不做射线）
+	if (bRequireGripPoint && HasGripPoints())
+	{
+		FVector GripLocation;
+		FVector GripNormal;
+		return FindNearestGripPoint(GetGripQueryLocation(Hand), GripSnapDistance, GripLocation, GripNormal);
+	}
+
+	return true;
 }
 
 bool AClimbableVolume::CanBeGrabbedByGravityGlove_Implementation() const
@@ -87,11 +110,282 @@ void AClimbableVolume::OnReleased_Implementation(UPlayerGrabHand* Hand)
 	}
 }
 
-void AClimbableVolume::OnGrabSelected_Implementation()
+void AClimbableVolume::OnGrabSelected_Implementation(UPlayerGrabHand* Hand)
+{
+}
+
+void AClimbableVolume::OnGrabDeselected_Implementation(UPlayerGrabHand* Hand)
+{
+}
+
+
+// ==================== 抓点 ====================
+
+bool AClimbableVolume::FindNearestGripPoint(const FVector& WorldLocation, float MaxDistance, FVector& OutLocation, FVector& OutNormal, bool* bOutIsLedge) const
+{
+	const int32 NumPoints = GripLocalPositions.Num();
+	if (!Box || NumPoints == 0 || GripLocalNormals.Num() != NumPoints || GripIsLedge.Num() != NumPoints)
+	{
+		return false;
+	}
+
+	// 在局部空间比较，按缩放换算回世界距离（旋转不改变长度）
+	const FTransform BoxTransform = Box->GetComponentTransform();
+	const FVector3f LocalQuery = FVector3f(BoxTransform.InverseTransformPosition(WorldLocation));
+	const FVector3f Scale = FVector3f(BoxTransform.GetScale3D());
+	const float MaxDistSq = FMath::Square(MaxDistance);
+	const float LedgeScaleSq = FMath::Square(LedgeDistanceScale);
+
+	int32 BestIndex = INDEX_NONE;
+	float BestScore = MAX_flt;
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		const float DistSq = ((GripLocalPositions[Index] - LocalQuery) * Scale).SizeSquared();
+		if (DistSq > MaxDistSq)
+		{
+			continue;
+		}
+
+		const float Score = GripIsLedge[Index] ? DistSq * LedgeScaleSq : DistSq;
+		if (Score < BestScore)
+		{
+			BestScore = Score;
+			BestIndex = Index;
+		}
+	}
+
+	if (BestIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutLocation = BoxTransform.TransformPosition(FVector(GripLocalPositions[BestIndex]));
+	OutNormal = BoxTransform.TransformVectorNoScale(FVector(GripLocalNormals[BestIndex]));
+	if (bOutIsLedge)
+	{
+		*bOutIsLedge = GripIsLedge[BestIndex] != 0;
+	}
+	return true;
+}
+
+bool AClimbableVolume::FindLandingSurfaceZ(const FVector& WorldLocation, float MaxHorizontalDistance, float MaxDrop, float& OutZ) const
+{
+	const int32 NumPoints = GripLocalPositions.Num();
+	if (!Box || NumPoints == 0 || GripLocalNormals.Num() != NumPoints)
+	{
+		return false;
+	}
+
+	const FTransform BoxTransform = Box->GetComponentTransform();
+	const float MaxDistSq = FMath::Square(MaxHorizontalDistance);
+
+	float BestDistSq = MAX_flt;
+	bool bFound = false;
+	for (int32 Index = 0; Index < NumPoints; ++Index)
+	{
+		// 只看顶面（墙面抓点不能落脚）
+		if (BoxTransform.TransformVectorNoScale(FVector(GripLocalNormals[Index])).Z < LedgeMinNormalZ)
+		{
+			continue;
+		}
+
+		const FVector Point = BoxTransform.TransformPosition(FVector(GripLocalPositions[Index]));
+		const float Drop = WorldLocation.Z - Point.Z;
+		const float DistSq = FVector::DistSquared2D(Point, WorldLocation);
+		if (Drop < 0.0f || Drop > MaxDrop || DistSq > MaxDistSq || DistSq >= BestDistSq)
+		{
+			continue;
+		}
+
+		BestDistSq = DistSq;
+		OutZ = Point.Z;
+		bFound = true;
+	}
+
+	return bFound;
+}
+
+FVector AClimbableVolume::GetGripQueryLocation(const UPlayerGrabHand* Hand) const
 {
+	if (!Hand)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// PC 的手不在墙面上，用准星命中点
+	if (const ABasePCPlayer* PCPlayer = Cast<ABasePCPlayer>(Hand->GetOwner()))
+	{
+		if (PCPlayer->TargetedObject == this && PCPlayer->bTraceHit)
+		{
+			return PCPlayer->TargetedImpactPoint;
+		}
+	}
+
+	return Hand->GetComponentLocation();
 }
 
-void AClimbableVolume::OnGrabDeselected_Implementation()
+#if WITH_EDITOR
+void AClimbableVolume::BakeGripPoints()
 {
+	UWorld* World = GetWorld();
+	if (!World || !Box)
+	{
+		return;
+	}
+
+	Modify();
+	GripLocalPositions.Reset();
+	GripLocalNormals.Reset();
+	GripIsLedge.Reset();
+
+	const FTransform BoxTransform = Box->GetComponentTransform();
+	const FVector Extent = Box->GetUnscaledBoxExtent();
+	const FVector ScaledExtent = Extent * BoxTransform.GetScale3D().GetAbs();
+	const float Spacing = FMath::Max(GripSampleSpacing, 2.0f);
+
+	FCollisionObjectQueryParams ObjQuery;
+	ObjQuery.AddObjectTypesToQuery(ECC_WorldStatic);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbGripBake), true);
+	QueryParams.AddIgnoredActor(this);
+
+	// 每类表面各自计数，超出预算的点丢弃并在烘焙结束时警告
+	int32 NumTop = 0;
+	int32 NumWall = 0;
+	int32 NumDroppedTop = 0;
+	int32 NumDroppedWall = 0;
+	auto AddGripPoint = [&](const FHitResult& Hit, bool bIsLedge, bool bIsWall)
+	{
+		int32& Count = bIsWall ? NumWall : NumTop;
+		if (Count >= (bIsWall ? MaxWallGripPoints : MaxTopGripPoints))
+		{
+			++(bIsWall ? NumDroppedWall : NumDroppedTop);
+			return;
+		}
+		++Count;
+		GripLocalPositions.Add(FVector3f(BoxTransform.InverseTransformPosition(Hit.ImpactPoint)));
+		GripLocalNormals.Add(FVector3f(BoxTransform.InverseTransformVectorNoScale(Hit.ImpactNormal)));
+		GripIsLedge.Add(bIsLedge ? 1 : 0);
+	};
+
+	// 1) 顶面：在盒体水平截面上网格采样，自上而下检测
+	const int32 NumX = FMath::Max(1, FMath::CeilToInt(2.0f * ScaledExtent.X / Spacing));
+	const int32 NumY = FMath::Max(1, FMath::CeilToInt(2.0f * ScaledExtent.Y / Spacing));
+
+	TArray<FHitResult> TopHits;
+	TArray<bool> TopValid;
+	TopHits.SetNum(NumX * NumY);
+	TopValid.Init(false, NumX * NumY);
+
+	for (int32 IX = 0; IX < NumX; ++IX)
+	{
+		for (int32 IY = 0; IY < NumY; ++IY)
+		{
+			const float LocalX = -Extent.X + (IX + 0.5f) * (2.0f * Extent.X / NumX);
+			const float LocalY = -Extent.Y + (IY + 0.5f) * (2.0f * Extent.Y / NumY);
+			const FVector Start = BoxTransform.TransformPosition(FVector(LocalX, LocalY, Extent.Z));
+			const FVector End = BoxTransform.TransformPosition(FVector(LocalX, LocalY, -Extent.Z));
+
+			FHitResult& Hit = TopHits[IX * NumY + IY];
+			TopValid[IX * NumY + IY] = World->LineTraceSingleByObjectType(Hit, Start, End, ObjQuery, QueryParams) &&
+				!Hit.bStartPenetrating && Hit.ImpactNormal.Z >= LedgeMinNormalZ;
+		}
+	}
+
+	// 边沿：相邻采样没有顶面，或落差超过 LedgeMinDrop（盒体边界外的情况未知，不算边沿）
+	TArray<int32> InteriorTopIndices;
+	for (int32 IX = 0; IX < NumX; ++IX)
+	{
+		for (int32 IY = 0; IY < NumY; ++IY)
+		{
+			const int32 Index = IX * NumY + IY;
+			if (!TopValid[Index])
+			{
+				continue;
+			}
+
+			bool bIsLedge = false;
+			const FIntPoint Neighbors[] = { {IX - 1, IY}, {IX + 1, IY}, {IX, IY - 1}, {IX, IY + 1} };
+			for (const FIntPoint& Neighbor : Neighbors)
+			{
+				if (Neighbor.X < 0 || Neighbor.X >= NumX || Neighbor.Y < 0 || Neighbor.Y >= NumY)
+				{
+					continue;
+				}
+
+				const int32 NeighborIndex = Neighbor.X * NumY + Neighbor.Y;
+				if (!TopValid[NeighborIndex] ||
+					TopHits[Index].ImpactPoint.Z - TopHits[NeighborIndex].ImpactPoint.Z > LedgeMinDrop)
+				{
+					bIsLedge = true;
+					break;
+				}
+			}
+
+			// 先加入边沿，内部顶面点预算不足时只丢内部点
+			if (bIsLedge)
+			{
+				AddGripPoint(TopHits[Index], true, false);
+			}
+			else
+			{
+				InteriorTopIndices.Add(Index);
+			}
+		}
+	}
+
+	for (const int32 Index : InteriorTopIndices)
+	{
+		AddGripPoint(TopHits[Index], false, false);
+	}
+
+	// 2) 墙面：从四个侧面向内检测
+	const int32 NumZ = FMath::Max(1, FMath::CeilToInt(2.0f * ScaledExtent.Z / Spacing));
+	for (int32 Axis = 0; Axis < 2; ++Axis)
+	{
+		const int32 OtherAxis = 1 - Axis;
+		const int32 NumAlong = Axis == 0 ? NumY : NumX;
+
+		for (const float Sign : { -1.0f, 1.0f })
+		{
+			for (int32 IA = 0; IA < NumAlong; ++IA)
+			{
+				for (int32 IZ = 0; IZ < NumZ; ++IZ)
+				{
+					FVector LocalStart;
+					LocalStart[Axis] = Sign * Extent[Axis];
+					LocalStart[OtherAxis] = -Extent[OtherAxis] + (IA + 0.5f) * (2.0f * Extent[OtherAxis] / NumAlong);
+					LocalStart.Z = -Extent.Z + (IZ + 0.5f) * (2.0f * Extent.Z / NumZ);
+
+					FVector LocalEnd = LocalStart;
+					LocalEnd[Axis] = -LocalStart[Axis];
+
+					FHitResult Hit;
+					if (World->LineTraceSingleByObjectType(Hit, BoxTransform.TransformPosition(LocalStart),
+						BoxTransform.TransformPosition(LocalEnd), ObjQuery, QueryParams) &&
+						!Hit.bStartPenetrating && Hit.ImpactNormal.Z < LedgeMinNormalZ)
+					{
+						AddGripPoint(Hit, false, true);
+					}
+				}
+			}
+		}
+	}
+
+	if (NumDroppedTop > 0 || NumDroppedWall > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("ClimbableVolume %s: Grip budget exceeded, dropped %d top / %d wall points (raise MaxTopGripPoints/MaxWallGripPoints or GripSampleSpacing)"),
+			*GetName(), NumDroppedTop, NumDroppedWall);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("ClimbableVolume %s: Baked %d grip points (%d top, %d wall)"), *GetName(), GripLocalPositions.Num(), NumTop, NumWall);
 }
 
+void AClimbableVolume::ClearGripPoints()
+{
+	Modify();
+	GripLocalPositions.Reset();
+	GripLocalNormals.Reset();
+	GripIsLedge.Reset();
+}
+#endif
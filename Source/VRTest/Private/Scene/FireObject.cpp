@@ -7,6 +7,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Effect/EffectTypes.h"
 #include "Effect/Effectable.h"
+#include "Effect/EffectQueueSubsystem.h"
 #include "Game/CollisionConfig.h"
 #include "NiagaraComponent.h"
 
@@ -67,5 +68,6 @@ void AFireObject::OnFireSphereBeginOverlap(
 	FireEffect.Causer = this;
 	FireEffect.Instigator = nullptr;
 
-	IEffectable::Execute_ApplyEffect(OtherActor, FireEffect);
+	// 火势蔓延时同一帧可能波及多个角色，统一入队结算
+	UEffectQueueSubsystem::ApplyEffect(OtherActor, FireEffect);
 }
@@ -11,6 +11,8 @@
 #include "Skill/SkillAsset.h"
 
 #include "Engine/World.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 UPlayerSkillComponent::UPlayerSkillComponent()
 {
@@ -36,6 +38,15 @@ void UPlayerSkillComponent::BeginPlay()
 	{
 		UE_LOG(LogTemp, Log, TEXT("SkillComponent: GameSettings not found"));
 	}
+
+	// 绘制管理器开局生成一次，之后每次绘制复用
+	StarDrawManager = SpawnStarDrawManager();
+
+	// BeginPlay 前学会的技能（蓝图默认值/存档恢复）此时才有策略映射
+	for (const ESkillType SkillType : LearnedSkills)
+	{
+		PreloadStrategy(SkillType);
+	}
 }
 
 bool UPlayerSkillComponent::StartStarDraw(USceneComponent* InputSource, bool bIsRight)
@@ -75,6 +86,7 @@ bool UPlayerSkillComponent::StartStarDraw(USceneComponent* InputSource, bool bIs
 
 	bIsRightHandDrawing = bIsRight;
 	bIsDrawing = true;
+	PreparedSkill = ESkillType::None;
 
 	// 缓存本次输入源，供 Finish/Strategy 使用
 	FSkillContext Context;
@@ -82,7 +94,10 @@ bool UPlayerSkillComponent::StartStarDraw(USceneComponent* InputSource, bool bIs
 	Context.bIsRightHand = bIsRightHandDrawing;
 	CachedDrawContext = Context;
 
-	StarDrawManager = SpawnStarDrawManager();
+	if (!StarDrawManager)
+	{
+		StarDrawManager = SpawnStarDrawManager();
+	}
 	if (!StarDrawManager)
 	{
 		bIsDrawing = false;
@@ -106,10 +121,9 @@ ESkillType UPlayerSkillComponent::FinishStarDraw()
 	if (StarDrawManager)
 	{
 		Result = StarDrawManager->FinishDraw();
+		StarDrawManager->ResetDraw();
 	}
 
-	DestroyStarDrawManager();
-
 	// 只要识别结果有效，就尝试触发
 	if (Result != ESkillType::None)
 	{
@@ -127,6 +141,59 @@ void UPlayerSkillComponent::LearnSkill(ESkillType SkillType)
 	if (SkillType != ESkillType::None)
 	{
 		LearnedSkills.Add(SkillType);
+		PreloadStrategy(SkillType);
+	}
+}
+
+void UPlayerSkillComponent::PreloadStrategy(ESkillType SkillType)
+{
+	if (!HasBegunPlay() || StrategyInstanceCache.Contains(SkillType) || StrategyPreloadHandles.Contains(SkillType))
+	{
+		return;
+	}
+
+	const TSubclassOf<ASkillStrategyBase>* StrategyClass = StrategyClassMap.Find(SkillType);
+	if (!StrategyClass || !(*StrategyClass))
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetsToLoad;
+	GetDefault<ASkillStrategyBase>(StrategyClass->Get())->GetPreloadAssets(AssetsToLoad);
+	if (AssetsToLoad.Num() == 0)
+	{
+		OnStrategyPreloaded(SkillType);
+		return;
+	}
+
+	// 资源已在内存中时 RequestAsyncLoad 会立即回调，所以先登记句柄占位，避免回调里重复请求
+	StrategyPreloadHandles.Add(SkillType, nullptr);
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetsToLoad,
+		FStreamableDelegate::CreateUObject(this, &UPlayerSkillComponent::OnStrategyPreloaded, SkillType));
+	if (!Handle.IsValid())
+	{
+		// 请求失败（路径无效等）：不留空句柄占位，否则之后无法重试；直接按已加载处理（释放时再同步加载）
+		StrategyPreloadHandles.Remove(SkillType);
+		OnStrategyPreloaded(SkillType);
+		return;
+	}
+	if (TSharedPtr<FStreamableHandle>* Slot = StrategyPreloadHandles.Find(SkillType))
+	{
+		*Slot = Handle;
+	}
+}
+
+void UPlayerSkillComponent::OnStrategyPreloaded(ESkillType SkillType)
+{
+	if (!HasLearnedSkill(SkillType))
+	{
+		return;
+	}
+
+	// 放入池中：之后释放直接复用，不再 SpawnActor
+	if (!GetStrategyForSkill(SkillType))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SkillComponent: failed to prewarm strategy for %s"), *UEnum::GetValueAsString(SkillType));
 	}
 }
 
@@ -188,14 +255,39 @@ AStarDrawManager* UPlayerSkillComponent::SpawnStarDrawManager()
 
 	FActorSpawnParameters Params;
 	Params.Owner = GetOwner();
-	return World->SpawnActor<AStarDrawManager>(AStarDrawManager::StaticClass(), Params);
+	AStarDrawManager* Manager = World->SpawnActor<AStarDrawManager>(AStarDrawManager::StaticClass(), Params);
+	if (Manager)
+	{
+		Manager->OnStarDrawProgress.AddDynamic(this, &UPlayerSkillComponent::HandleStarDrawProgress);
+	}
+	return Manager;
+}
+
+void UPlayerSkillComponent::HandleStarDrawProgress(const TArray<ESkillType>& CandidateSkills, ESkillType PredictedSkill, ESkillType CompletedSkill)
+{
+	if (!bIsDrawing || PredictedSkill == ESkillType::None || PredictedSkill == PreparedSkill)
+	{
+		return;
+	}
+
+	if (!CachedOwnerPlayer || !HasLearnedSkill(PredictedSkill))
+	{
+		return;
+	}
+
+	PreparedSkill = PredictedSkill;
+
+	// 策略实例在这里就生成好，松手释放时不再需要生成
+	if (ASkillStrategyBase* Strategy = GetStrategyForSkill(PredictedSkill))
+	{
+		Strategy->PrepareCast(CachedOwnerPlayer, CachedDrawContext);
+	}
 }
 
 void UPlayerSkillComponent::DestroyStarDrawManager()
 {
 	if (StarDrawManager)
 	{
-		// 通过统一的 CleanupAndDestroy 接口完成清理；若不存在则直接销毁
 		StarDrawManager->CleanupAndDestroy();
 		StarDrawManager = nullptr;
 	}
@@ -206,6 +298,24 @@ void UPlayerSkillComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	// 清理绘制会话
 	DestroyStarDrawManager();
 
+	// 取消未完成的预加载，释放资源句柄
+	for (TPair<ESkillType, TSharedPtr<FStreamableHandle>>& Pair : StrategyPreloadHandles)
+	{
+		if (!Pair.Value.IsValid())
+		{
+			continue;
+		}
+		if (Pair.Value->IsLoadingInProgress())
+		{
+			Pair.Value->CancelHandle();
+		}
+		else
+		{
+			Pair.Value->ReleaseHandle();
+		}
+	}
+	StrategyPreloadHandles.Reset();
+
 	// 清理策略实例（Actor）
 	for (TPair<ESkillType, TObjectPtr<ASkillStrategyBase>>& Pair : StrategyInstanceCache)
 	{
@@ -41,69 +41,48 @@ void USkillAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedE
 
 ESkillType USkillAsset::GetSkillTypeFromTrail(const TArray<EStarDrawDirection>& Trail) const
 {
-	if (Trail.Num() == 0)
-	{
-		return ESkillType::None;
-	}
-
-	const FString Key = BuildTrailKey(Trail);
-	if (Key.IsEmpty())
-	{
-		return ESkillType::None;
-	}
-
-	if (const ESkillType* Found = TrailToSkill.Find(Key))
-	{
-		return *Found;
-	}
-
-	return ESkillType::None;
-}
-
-FString USkillAsset::BuildTrailKey(const TArray<EStarDrawDirection>& Trail) const
-{
-	FString Key;
-	Key.Reserve(Trail.Num());
-	for (const EStarDrawDirection Dir : Trail)
-	{
-		Key += FString::FromInt(StarDrawDirectionToInt(Dir));
-	}
-	return Key;
+	return TrailTrie.Find(Trail);
 }
 
 void USkillAsset::RebuildTrailToSkillCache()
 {
-	TrailToSkill.Empty(StarDrawTrailPairs.Num());
+	TrailTrie.Reset();
 
-	auto AddOrOverrideWithWarning = [this](const FString& Key, ESkillType Skill, int32 PairIndex, const TCHAR* KeyLabel)
+	auto AddOrOverrideWithWarning = [this](const TArray<EStarDrawDirection>& Trail, ESkillType Skill, int32 PairIndex, const TCHAR* KeyLabel)
 	{
-		if (const ESkillType* Existing = TrailToSkill.Find(Key))
+		ESkillType Existing = ESkillType::None;
+		TrailTrie.Add(Trail, Skill, Existing);
+
+		if (Existing != ESkillType::None)
 		{
+			FString Key;
+			for (const EStarDrawDirection Dir : Trail)
+			{
+				Key.AppendInt(StarDrawDirectionToInt(Dir));
+			}
+
 			UE_LOG(LogTemp, Warning,
 				TEXT("SkillAsset[%s]: duplicate %s key '%s' at StarDrawTrailPairs[%d]. Existing=%s, New=%s. New overrides old."),
 				*GetName(),
 				KeyLabel,
 				*Key,
 				PairIndex,
-				*UEnum::GetValueAsString(*Existing),
+				*UEnum::GetValueAsString(Existing),
 				*UEnum::GetValueAsString(Skill));
 		}
-
-		TrailToSkill.Add(Key, Skill);
 	};
 
 	for (int32 Index = 0; Index < StarDrawTrailPairs.Num(); ++Index)
 	{
 		const FStarDrawTrailPair& Pair = StarDrawTrailPairs[Index];
-		const FString ForwardKey = BuildTrailKey(Pair.Trail);
-		if (ForwardKey.IsEmpty())
+		if (Pair.Trail.Num() == 0)
 		{
 			UE_LOG(LogTemp, Warning, TEXT("SkillAsset[%s]: StarDrawTrailPairs[%d] has empty trail, ignored."), *GetName(), Index);
 			continue;
 		}
 
 		// 正向写入
-		AddOrOverrideWithWarning(ForwardKey, Pair.Skill, Index, TEXT("forward"));
+		AddOrOverrideWithWarning(Pair.Trail, Pair.Skill, Index, TEXT("forward"));
 
 		// 反向写入：reverse + opposite
 		TArray<EStarDrawDirection> ReverseOppositeTrail;
@@ -112,10 +91,9 @@ void USkillAsset::RebuildTrailToSkillCache()
 		{
 			ReverseOppositeTrail.Add(StarDrawDirectionGetOpposite(Pair.Trail[i]));
 		}
-		const FString ReverseKey = BuildTrailKey(ReverseOppositeTrail);
-		if (!ReverseKey.IsEmpty() && ReverseKey != ForwardKey)
+		if (ReverseOppositeTrail != Pair.Trail)
 		{
-			AddOrOverrideWithWarning(ReverseKey, Pair.Skill, Index, TEXT("reverse"));
+			AddOrOverrideWithWarning(ReverseOppositeTrail, Pair.Skill, Index, TEXT("reverse"));
 		}
 	}
 }
@@ -2,4 +2,13 @@
 
 #include "Skill/SkillStrategyBase.h"
 
-// Intentionally left empty: ASkillStrategyBase is header-only for now.
+void ASkillStrategyBase::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	for (const TSoftObjectPtr<UObject>& Asset : PreloadAssets)
+	{
+		if (!Asset.IsNull())
+		{
+			OutAssets.AddUnique(Asset.ToSoftObjectPath());
+		}
+	}
+}
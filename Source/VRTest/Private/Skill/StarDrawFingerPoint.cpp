@@ -5,7 +5,6 @@
 
 #include "Components/SphereComponent.h"
 #include "Components/StaticMeshComponent.h"
-#include "Skill/StarDrawManager.h"
 
 AStarDrawFingerPoint::AStarDrawFingerPoint()
 {
@@ -14,31 +13,10 @@ AStarDrawFingerPoint::AStarDrawFingerPoint()
 	SphereCollision = CreateDefaultSubobject<USphereComponent>(TEXT("SphereCollision"));
 	SetRootComponent(SphereCollision);
 	SphereCollision->SetSphereRadius(4.f);
-	SphereCollision->SetCollisionProfileName(CP_STAR_FINGER);
-	SphereCollision->SetGenerateOverlapEvents(true);
+	SphereCollision->SetCollisionProfileName(CP_NO_COLLISION);
+	SphereCollision->SetGenerateOverlapEvents(false);
 
 	Mesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 	Mesh->SetupAttachment(SphereCollision);
 	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 }
-
-void AStarDrawFingerPoint::BeginPlay()
-{
-	Super::BeginPlay();
-
-	if (SphereCollision)
-	{
-		SphereCollision->OnComponentBeginOverlap.AddDynamic(this, &AStarDrawFingerPoint::OnFingerOverlapBegin);
-	}
-}
-
-void AStarDrawFingerPoint::OnFingerOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-                                                UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult)
-{
-	if (!DrawManager || !OtherActor)
-	{
-		return;
-	}
-
-	DrawManager->NotifyFingerTouchActor(OtherActor);
-}
@@ -13,10 +13,45 @@
 #include "GameFramework/PlayerController.h"
 #include "DrawDebugHelpers.h"
 #include "NiagaraComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "NiagaraDataInterfaceArrayFunctionLibrary.h"
 #include "Game/GameSettings.h"
 #include "Game/MyGameplayTags.h"
 
+namespace StarDrawVisual
+{
+	/** 两个 Niagara 系统中的点数组参数名 */
+	const FName PointArrayParam(TEXT("PointArray"));
+
+	/** DrawLine 点缓冲的预分配容量（一般轨迹不会超过这个长度） */
+	constexpr int32 DrawLineReserve = 32;
+
+	/** 把蓝图类 CDO 上 Mesh 组件的网格/材质复制到目标组件，返回该 Mesh 的相对变换 */
+	FTransform CopyMeshTemplate(const UStaticMeshComponent* TemplateMesh, UStaticMeshComponent* Target)
+	{
+		if (!TemplateMesh || !Target)
+		{
+			return FTransform::Identity;
+		}
+
+		Target->SetStaticMesh(TemplateMesh->GetStaticMesh());
+		for (int32 MaterialIndex = 0; MaterialIndex < TemplateMesh->GetNumMaterials(); ++MaterialIndex)
+		{
+			Target->SetMaterial(MaterialIndex, TemplateMesh->GetMaterial(MaterialIndex));
+		}
+		return TemplateMesh->GetRelativeTransform();
+	}
+
+	/** 纯表现组件：不参与碰撞、不影响导航、不投影 */
+	void SetupVisualComponent(UStaticMeshComponent* Component)
+	{
+		Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Component->SetGenerateOverlapEvents(false);
+		Component->SetCanEverAffectNavigation(false);
+		Component->SetCastShadow(false);
+	}
+}
+
 void AStarDrawManager::BeginPlay()
 {
 	Super::BeginPlay();
@@ -29,40 +64,82 @@ void AStarDrawManager::BeginPlay()
 
 	const UGameSettings* Settings = UGameSettings::Get();
 	CachedSkillAsset = Settings ? Settings->GetSkillAsset() : nullptr;
-	DrawLineEffect->SetAsset(CachedSkillAsset->DrawLineEffect);
-	FingerPointEffect->SetAsset(CachedSkillAsset->FingerPointEffect);
+	if (CachedSkillAsset)
+	{
+		DrawLineEffect->SetAsset(CachedSkillAsset->DrawLineEffect);
+		FingerPointEffect->SetAsset(CachedSkillAsset->FingerPointEffect);
+	}
+
+	ApplyVisualTemplates();
+
+	DrawLinePoints.Reserve(StarDrawVisual::DrawLineReserve);
+	FingerLinePoints.SetNumZeroed(2);
 }
 
 AStarDrawManager::AStarDrawManager()
 {
 	PrimaryActorTick.bCanEverTick = true;
-	
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("Root")));
+
 	DrawLineEffect = CreateDefaultSubobject<UNiagaraComponent>(TEXT("DrawLineEffect"));
 	DrawLineEffect->SetupAttachment(RootComponent);
-	DrawLineEffect->SetVisibility(true);
-	
+	DrawLineEffect->SetAutoActivate(false);
+
 	FingerPointEffect = CreateDefaultSubobject<UNiagaraComponent>(TEXT("FingerPointEffect"));
 	FingerPointEffect->SetupAttachment(RootComponent);
-	FingerPointEffect->SetVisibility(true);
+	FingerPointEffect->SetAutoActivate(false);
+
+	MainStarInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("MainStarInstances"));
+	MainStarInstances->SetupAttachment(RootComponent);
+	StarDrawVisual::SetupVisualComponent(MainStarInstances);
+
+	OtherStarInstances = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("OtherStarInstances"));
+	OtherStarInstances->SetupAttachment(RootComponent);
+	StarDrawVisual::SetupVisualComponent(OtherStarInstances);
+
+	FingerPointMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("FingerPointMesh"));
+	FingerPointMesh->SetupAttachment(RootComponent);
+	FingerPointMesh->SetUsingAbsoluteLocation(true);
+	FingerPointMesh->SetUsingAbsoluteRotation(true);
+	FingerPointMesh->SetUsingAbsoluteScale(true);
+	FingerPointMesh->SetVisibility(false);
+	StarDrawVisual::SetupVisualComponent(FingerPointMesh);
 }
 
 void AStarDrawManager::StartDraw(USceneComponent* InInputSource)
 {
+	if (bIsDrawing)
+	{
+		ResetDraw();
+	}
+
 	InputSource = InInputSource;
 	bIsDrawing = (InputSource != nullptr);
 	CachedResult = ESkillType::None;
 
-	DirectionChoose.Reset();
-	MainStars.Reset();
-	OtherStars.Reset();
-	FingerPoint = nullptr;
-
 	if (!bIsDrawing)
 	{
 		return;
 	}
 
-	FirstTouch();
+	const FStarDrawTrailTrie* Trie = CachedSkillAsset ? &CachedSkillAsset->GetTrailTrie() : nullptr;
+	Session.Begin(GetPlayerPivotLocation(), GetInputSourceLocation(), GetInputSourceForwardVector(), Distance, LineLength,
+		Trie, bHideDeadStars);
+	RefreshStarInstances();
+	bVFXPointsDirty = true;
+
+	FingerPointMesh->SetWorldTransform(FingerPointVisualTransform * FTransform(Session.GetFingerLocation()));
+	FingerPointMesh->SetVisibility(true);
+
+	DrawLineEffect->Activate(true);
+	FingerPointEffect->Activate(true);
+	UpdateVFX();
+
+	SetActorTickEnabled(true);
+
+	BroadcastProgress();
 }
 
 ESkillType AStarDrawManager::FinishDraw()
@@ -78,253 +155,141 @@ ESkillType AStarDrawManager::FinishDraw()
 	return CachedResult;
 }
 
-
-void AStarDrawManager::Tick(float DeltaSeconds)
+void AStarDrawManager::ResetDraw()
 {
-	Super::Tick(DeltaSeconds);
+	bIsDrawing = false;
+	InputSource = nullptr;
+	Session.Reset();
+	bVFXPointsDirty = true;
 
-	if (!bIsDrawing || !FingerPoint)
-	{
-		return;
-	}
+	SetActorTickEnabled(false);
 
-	UpdateFingerPointLocation(DeltaSeconds);
-	UpdateVFX();
+	MainStarInstances->ClearInstances();
+	OtherStarInstances->ClearInstances();
+	FingerPointMesh->SetVisibility(false);
 
-	if (bDebugDraw)
-	{
-		DrawDebugPoint(GetWorld(), FingerPointLocation, 6.f, FColor::Green, false, 0.f);
-	}
+	DrawLineEffect->DeactivateImmediate();
+	FingerPointEffect->DeactivateImmediate();
 }
 
-
-void AStarDrawManager::NotifyFingerTouchActor(AActor* TouchedActor)
+void AStarDrawManager::CleanupAndDestroy()
 {
-	if (!bIsDrawing || !TouchedActor)
-	{
-		return;
-	}
-	
-	if (!TouchedActor->ActorHasTag(SkillTags::OtherStars))
-	{
-		return;
-	}
-
-	AStarDrawOtherStar* OtherStar = Cast<AStarDrawOtherStar>(TouchedActor);
-	if (!OtherStar)
-	{
-		return;
-	}
-
-	TouchOtherStar(OtherStar);
+	ResetDraw();
+	Destroy();
 }
 
 
-void AStarDrawManager::FirstTouch()
+void AStarDrawManager::Tick(float DeltaSeconds)
 {
-	PlayerPivotLocation = GetPlayerPivotLocation();
-
-	const FVector ControllerLocation = GetInputSourceLocation();
-	const FVector Forward = GetInputSourceForwardVector();
-	Radius = CalculateRadiusOnXY(PlayerPivotLocation, ControllerLocation, Forward, Distance);
-
-	// 蓝图：FingerPointLocation = ControllerLocation + Forward * Distance
-	FingerPointLocation = ControllerLocation + Forward * Distance;
+	Super::Tick(DeltaSeconds);
 
-	SpawnFingerPoint();
-	SpawnMainStarAt(FingerPointLocation);
-	SpawnOtherStarsAround(FingerPointLocation);
-}
+	if (!bIsDrawing)
+	{
+		return;
+	}
 
+	UpdateFingerPointLocation(DeltaSeconds);
 
-void AStarDrawManager::TouchOtherStar(AStarDrawOtherStar* OtherStar)
-{
-	if (!OtherStar)
+	EStarDrawDirection TouchedDirection;
+	if (Session.FindTouchedCandidate(StarTouchRadius, TouchedDirection))
 	{
-		return;
+		TouchCandidate(TouchedDirection);
 	}
 
-	const EStarDrawDirection CurrentDir = OtherStar->GetDirection();
+	UpdateVFX();
 
-	// 蓝图：如果不是上一步的反方向才记录（避免来回抖动）
-	if (DirectionChoose.Num() > 0)
+	if (bDebugDraw)
 	{
-		const EStarDrawDirection Last = DirectionChoose.Last();
-		if (StarDrawDirectionGetOpposite(CurrentDir) == Last)
+		DrawDebugPoint(GetWorld(), Session.GetFingerLocation(), 6.f, FColor::Green, false, 0.f);
+		for (int32 Index = 0; Index < FStarDrawSession::NumDirections; ++Index)
 		{
-			return;
+			const EStarDrawDirection Dir = static_cast<EStarDrawDirection>(Index);
+			if (Session.IsCandidateActive(Dir))
+			{
+				DrawDebugSphere(GetWorld(), Session.GetCandidate(Dir), StarTouchRadius, 8, FColor::Yellow, false, 0.f);
+			}
 		}
 	}
-
-	DirectionChoose.Add(CurrentDir);
-
-	const FVector HitLocation = OtherStar->GetActorLocation();
-	SpawnMainStarAt(HitLocation);
-	SpawnOtherStarsAround(HitLocation);
-	
-	CachedAudioSubsystem->PlayNormalSound2D(MyProjectTags::TAG_NormalSound_StarHit);
 }
 
 
-void AStarDrawManager::SpawnFingerPoint()
+void AStarDrawManager::TouchCandidate(EStarDrawDirection Direction)
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	if (!Session.ConfirmCandidate(Direction))
 	{
 		return;
 	}
 
-	// 优先从 SkillAsset 读取可视化蓝图类
-	if (CachedSkillAsset && CachedSkillAsset->FingerPointClass)
-	{
-		FingerPointClass = CachedSkillAsset->FingerPointClass;
-	}
+	RefreshStarInstances();
+	bVFXPointsDirty = true;
 
-	if (!FingerPointClass)
+	if (CachedAudioSubsystem)
 	{
-		FingerPointClass = AStarDrawFingerPoint::StaticClass();
+		CachedAudioSubsystem->PlayNormalSound2D(MyProjectTags::TAG_NormalSound_StarHit);
 	}
 
-	FActorSpawnParameters Params;
-	Params.Owner = this;
-	FingerPoint = World->SpawnActor<AStarDrawFingerPoint>(FingerPointClass, FingerPointLocation, FRotator::ZeroRotator, Params);
-	if (FingerPoint)
-	{
-		FingerPoint->SetDrawManager(this);
-		FingerPoint->SetActorLocation(FingerPointLocation);
-	}
+	BroadcastProgress();
 }
 
-void AStarDrawManager::SpawnMainStarAt(const FVector& Location)
+void AStarDrawManager::BroadcastProgress()
 {
-	UWorld* World = GetWorld();
-	if (!World)
+	if (!OnStarDrawProgress.IsBound())
 	{
 		return;
 	}
 
-	if (CachedSkillAsset && CachedSkillAsset->MainStarClass)
-	{
-		MainStarClass = CachedSkillAsset->MainStarClass;
-	}
-
-	if (!MainStarClass)
-	{
-		MainStarClass = AStarDrawMainStar::StaticClass();
-	}
-
-	FActorSpawnParameters Params;
-	Params.Owner = this;
-	AStarDrawMainStar* Star = World->SpawnActor<AStarDrawMainStar>(MainStarClass, Location, FRotator::ZeroRotator, Params);
-	if (Star)
-	{
-		MainStars.Add(Star);
-	}
+	TArray<ESkillType> CandidateSkills;
+	FStarDrawTrailTrie::SkillMaskToArray(Session.GetReachableSkillMask(), CandidateSkills);
+	OnStarDrawProgress.Broadcast(CandidateSkills, Session.GetPredictedSkill(), Session.GetCompletedSkill());
 }
 
-void AStarDrawManager::SpawnOtherStarsAround(const FVector& CenterLocation)
-{
-	ClearOtherStars();
+// ==================== 表现 ====================
 
-	UWorld* World = GetWorld();
-	if (!World)
+void AStarDrawManager::ApplyVisualTemplates()
+{
+	if (!CachedSkillAsset)
 	{
 		return;
 	}
 
-	if (CachedSkillAsset && CachedSkillAsset->OtherStarClass)
+	// 只读取蓝图类 CDO 上的 Mesh 组件，不生成 Actor
+	if (const AStarDrawMainStar* MainStarTemplate = CachedSkillAsset->MainStarClass ? GetDefault<AStarDrawMainStar>(CachedSkillAsset->MainStarClass.Get()) : nullptr)
 	{
-		OtherStarClass = CachedSkillAsset->OtherStarClass;
+		MainStarVisualTransform = StarDrawVisual::CopyMeshTemplate(MainStarTemplate->Mesh, MainStarInstances);
 	}
-
-	if (!OtherStarClass)
+	if (const AStarDrawOtherStar* OtherStarTemplate = CachedSkillAsset->OtherStarClass ? GetDefault<AStarDrawOtherStar>(CachedSkillAsset->OtherStarClass.Get()) : nullptr)
 	{
-		OtherStarClass = AStarDrawOtherStar::StaticClass();
+		OtherStarVisualTransform = StarDrawVisual::CopyMeshTemplate(OtherStarTemplate->Mesh, OtherStarInstances);
 	}
-
-	const TMap<EStarDrawDirection, FVector> PointsByDir = CalculateAdjacentPointsOnCylinder(PlayerPivotLocation, CenterLocation, LineLength);
-	if (PointsByDir.Num() != 8)
+	if (const AStarDrawFingerPoint* FingerPointTemplate = CachedSkillAsset->FingerPointClass ? GetDefault<AStarDrawFingerPoint>(CachedSkillAsset->FingerPointClass.Get()) : nullptr)
 	{
-		return;
-	}
-
-	for (const TPair<EStarDrawDirection, FVector>& Pair : PointsByDir)
-	{
-		const EStarDrawDirection Dir = Pair.Key;
-		if (DirectionChoose.Num()>0 && StarDrawDirectionGetOpposite(Dir) == DirectionChoose.Last())
-		{
-			// 不生成上一步的反方向
-			continue;
-		}
-		const FVector& SpawnLoc = Pair.Value;
-
-		FActorSpawnParameters Params;
-		Params.Owner = this;
-		AStarDrawOtherStar* Other = World->SpawnActor<AStarDrawOtherStar>(OtherStarClass, SpawnLoc, FRotator::ZeroRotator, Params);
-		if (Other)
-		{
-			Other->SetDirection(Dir);
-			OtherStars.Add(Other);
-		}
+		FingerPointVisualTransform = StarDrawVisual::CopyMeshTemplate(FingerPointTemplate->Mesh, FingerPointMesh);
 	}
 }
 
-
-void AStarDrawManager::ClearOtherStars()
+void AStarDrawManager::RefreshStarInstances()
 {
-	for (AStarDrawOtherStar* Star : OtherStars)
+	// MainStar 只增不减：补上新增的
+	const TArray<FVector>& MainStars = Session.GetMainStars();
+	for (int32 Index = MainStarInstances->GetInstanceCount(); Index < MainStars.Num(); ++Index)
 	{
-		if (Star)
-		{
-			Star->Destroy();
-		}
+		MainStarInstances->AddInstance(MainStarVisualTransform * FTransform(MainStars[Index]), true /*bWorldSpace*/);
 	}
-	OtherStars.Reset();
-}
-
 
-void AStarDrawManager::ClearMainStars()
-{
-	for (AStarDrawMainStar* Star : MainStars)
+	// 候选星每次确认都整体替换
+	TArray<FTransform> OtherStarTransforms;
+	OtherStarTransforms.Reserve(FStarDrawSession::NumDirections);
+	for (int32 Index = 0; Index < FStarDrawSession::NumDirections; ++Index)
 	{
-		if (Star)
+		const EStarDrawDirection Dir = static_cast<EStarDrawDirection>(Index);
+		if (Session.IsCandidateActive(Dir))
 		{
-			Star->Destroy();
+			OtherStarTransforms.Add(OtherStarVisualTransform * FTransform(Session.GetCandidate(Dir)));
 		}
 	}
-	MainStars.Reset();
-}
-
-// 新增统一清理函数
-void AStarDrawManager::CleanupAndDestroy()
-{
-	// 清理 Actor 持有的星星
-	ClearOtherStars();
-	ClearMainStars();
 
-	// 销毁 FingerPoint
-	if (FingerPoint)
-	{
-		FingerPoint->Destroy();
-		FingerPoint = nullptr;
-	}
-
-	// 停用并移除 Niagara VFX
-	if (DrawLineEffect)
-	{
-		DrawLineEffect->DeactivateImmediate();
-		DrawLineEffect->DestroyComponent();
-		DrawLineEffect = nullptr;
-	}
-	if (FingerPointEffect)
-	{
-		FingerPointEffect->DeactivateImmediate();
-		FingerPointEffect->DestroyComponent();
-		FingerPointEffect = nullptr;
-	}
-
-	// 最后自我销毁
-	Destroy();
+	OtherStarInstances->ClearInstances();
+	OtherStarInstances->AddInstances(OtherStarTransforms, false /*bShouldReturnIndices*/, true /*bWorldSpace*/);
 }
 
 FVector AStarDrawManager::GetPlayerPivotLocation() const
@@ -361,159 +326,71 @@ FVector AStarDrawManager::GetInputSourceForwardVector() const
 
 void AStarDrawManager::UpdateFingerPointLocation(float DeltaSeconds)
 {
-	const FVector ControllerLocation = GetInputSourceLocation();
-	const FVector Forward = GetInputSourceForwardVector();
-	FingerPointLocation = CalculateProjectionPointOnCylinder(PlayerPivotLocation, ControllerLocation, Forward, Radius);
-	FingerPoint->SetActorLocation(FingerPointLocation);
+	Session.UpdateFinger(GetInputSourceLocation(), GetInputSourceForwardVector());
+	FingerPointMesh->SetWorldTransform(FingerPointVisualTransform * FTransform(Session.GetFingerLocation()));
 }
 
 void AStarDrawManager::UpdateVFX()
 {
-	if (DrawLineEffect)
-	{
-		TArray<FVector> DrawLineLocations;
-		for (AStarDrawMainStar* Star : MainStars)
-			DrawLineLocations.Add(Star->GetActorLocation());
-		DrawLineLocations.Add(FingerPoint->GetActorLocation());
-		UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(DrawLineEffect, FName("PointArray"), DrawLineLocations);
-	}
-	if (FingerPointEffect)
-	{
-		TArray<FVector> FingerPointLineLocations;
-		FingerPointLineLocations.Add(FingerPoint->GetActorLocation());
-		FingerPointLineLocations.Add(GetInputSourceLocation());
-		UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(FingerPointEffect, FName("PointArray"), FingerPointLineLocations);
-	}
-}
-
-TMap<EStarDrawDirection, FVector> AStarDrawManager::CalculateAdjacentPointsOnCylinder(const FVector& PlayerPivot, const FVector& CenterLocation, float InLineLength) const
-{
-	// 对齐 Z（在蓝图库里 PlayerLocation.Z=StarLocation.Z）
-	FVector PlayerFlat = PlayerPivot;
-	PlayerFlat.Z = CenterLocation.Z;
+	const FVector FingerLocation = Session.GetFingerLocation();
 
-	const FVector OriginalVector = CenterLocation - PlayerFlat;
-	const float RadiusLocal = FVector(OriginalVector.X, OriginalVector.Y, 0.f).Size();
-	if (RadiusLocal <= KINDA_SMALL_NUMBER)
-	{
-		return {};
-	}
-
-	// Zita = acos((2R^2 - L^2) / (2R^2))
-	const float CosValue = (2.f * RadiusLocal * RadiusLocal - InLineLength * InLineLength) / (2.f * RadiusLocal * RadiusLocal);
-	const float ClampedCos = FMath::Clamp(CosValue, -1.f, 1.f);
-	const float ZitaDeg = FMath::RadiansToDegrees(FMath::Acos(ClampedCos));
-
-	FVector OriginalFlat = OriginalVector;
-	OriginalFlat.Z = 0.f;
-
-	const FVector LeftVector = OriginalFlat.RotateAngleAxis(-ZitaDeg, FVector::UpVector);
-	const FVector RightVector = OriginalFlat.RotateAngleAxis(ZitaDeg, FVector::UpVector);
-
-	const FVector LeftPoint = PlayerFlat + LeftVector;
-	const FVector RightPoint = PlayerFlat + RightVector;
-
-	const FVector UpVector = FVector(0, 0, InLineLength);
-	const FVector DownVector = FVector(0, 0, -InLineLength);
-
-	const FVector UpPoint = CenterLocation + UpVector;
-	const FVector DownPoint = CenterLocation + DownVector;
-	const FVector LeftUpPoint = LeftPoint + UpVector;
-	const FVector RightUpPoint = RightPoint + UpVector;
-	const FVector LeftDownPoint = LeftPoint + DownVector;
-	const FVector RightDownPoint = RightPoint + DownVector;
-
-	TMap<EStarDrawDirection, FVector> Result;
-	Result.Reserve(8);
-	Result.Add(EStarDrawDirection::Left, LeftPoint);
-	Result.Add(EStarDrawDirection::Right, RightPoint);
-	Result.Add(EStarDrawDirection::Up, UpPoint);
-	Result.Add(EStarDrawDirection::Down, DownPoint);
-	Result.Add(EStarDrawDirection::LeftUp, LeftUpPoint);
-	Result.Add(EStarDrawDirection::RightUp, RightUpPoint);
-	Result.Add(EStarDrawDirection::LeftDown, LeftDownPoint);
-	Result.Add(EStarDrawDirection::RightDown, RightDownPoint);
-	return Result;
-}
-
-float AStarDrawManager::CalculateRadiusOnXY(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float DistanceValue) const
-{
-	const FVector TargetLocation = ControllerLocation + Forward * DistanceValue;
-	return FVector(TargetLocation.X - PlayerPivot.X, TargetLocation.Y - PlayerPivot.Y, 0.f).Size();
-}
-
-FVector AStarDrawManager::CalculateProjectionPointOnCylinder(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float RadiusValue) const
-{
-	// 目标：从 ControllerLocation 沿 Forward 发射射线 R(t)=ControllerLocation+Forward*t，
-	// 与以 PlayerPivot 为轴、半径 RadiusValue 的无限圆柱面（绕世界 Z 轴）求交。
-	// 圆柱面方程（XY 平面）：(x-PlayerPivot.X)^2 + (y-PlayerPivot.Y)^2 = RadiusValue^2。
-	// 将射线代入并仅用 XY 分量求解 t。
-
-	const FVector2D PivotXY(PlayerPivot.X, PlayerPivot.Y);
-	const FVector2D OriginXY(ControllerLocation.X, ControllerLocation.Y);
-	const FVector2D DirXY(Forward.X, Forward.Y);
-
-	const float DirLenSq = DirXY.SquaredLength();
-	if (DirLenSq <= KINDA_SMALL_NUMBER)
-	{
-		// 射线几乎与圆柱轴平行（Forward XY 分量接近 0），无法与圆柱面稳定求交。
-		// 这里保持当前位置（不回退到某个错误的交点）。
-		return ControllerLocation;
-	}
-
-	const FVector2D Delta = OriginXY - PivotXY;
-
-	// 解二次方程：a t^2 + b t + c = 0
-	// a = dx^2 + dy^2
-	// b = 2 * (dx*(ox-px) + dy*(oy-py))
-	// c = (ox-px)^2 + (oy-py)^2 - r^2
-	const float A = DirLenSq;
-	const float B = 2.f * FVector2D::DotProduct(DirXY, Delta);
-	const float C = Delta.SquaredLength() - RadiusValue * RadiusValue;
-
-	const float Discriminant = B * B - 4.f * A * C;
-	if (Discriminant < 0.f)
-	{
-		// 无实根：射线在 XY 上不与圆柱面相交
-		return ControllerLocation;
-	}
-
-	const float SqrtD = FMath::Sqrt(Discriminant);
-	const float Inv2A = 1.f / (2.f * A);
-	const float t0 = (-B - SqrtD) * Inv2A;
-	const float t1 = (-B + SqrtD) * Inv2A;
-
-	// 选择最小的正根（最近的前向交点）
-	float t = TNumericLimits<float>::Max();
-	if (t0 >= 0.f)
-	{
-		t = t0;
-	}
-	if (t1 >= 0.f)
+	if (DrawLineEffect)
 	{
-		t = FMath::Min(t, t1);
+		if (bVFXPointsDirty)
+		{
+			// 星的集合变化：原地重写缓冲（Reset 保留容量），整体推送一次
+			const TArray<FVector>& MainStars = Session.GetMainStars();
+			DrawLinePoints.Reset();
+			DrawLinePoints.Append(MainStars);
+			DrawLinePoints.Add(FingerLocation);
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(DrawLineEffect, StarDrawVisual::PointArrayParam, DrawLinePoints);
+		}
+		else if (DrawLinePoints.Num() > 0 && !DrawLinePoints.Last().Equals(FingerLocation))
+		{
+			// 只有末端（手指）在动：只写这一个元素
+			DrawLinePoints.Last() = FingerLocation;
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVectorValue(DrawLineEffect, StarDrawVisual::PointArrayParam,
+				DrawLinePoints.Num() - 1, FingerLocation, false /*bSizeToFit*/);
+		}
 	}
 
-	if (t == TNumericLimits<float>::Max())
+	if (FingerPointEffect)
 	{
-		// 两个根都在射线反方向
-		return ControllerLocation;
+		const FVector SourceLocation = GetInputSourceLocation();
+		if (bVFXPointsDirty)
+		{
+			// 固定两个点，先定好数组长度
+			FingerLinePoints[0] = FingerLocation;
+			FingerLinePoints[1] = SourceLocation;
+			UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVector(FingerPointEffect, StarDrawVisual::PointArrayParam, FingerLinePoints);
+		}
+		else
+		{
+			if (!FingerLinePoints[0].Equals(FingerLocation))
+			{
+				FingerLinePoints[0] = FingerLocation;
+				UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVectorValue(FingerPointEffect, StarDrawVisual::PointArrayParam,
+					0, FingerLocation, false /*bSizeToFit*/);
+			}
+			if (!FingerLinePoints[1].Equals(SourceLocation))
+			{
+				FingerLinePoints[1] = SourceLocation;
+				UNiagaraDataInterfaceArrayFunctionLibrary::SetNiagaraArrayVectorValue(FingerPointEffect, StarDrawVisual::PointArrayParam,
+					1, SourceLocation, false /*bSizeToFit*/);
+			}
+		}
 	}
 
-	return ControllerLocation + Forward * t;
+	bVFXPointsDirty = false;
 }
 
 ESkillType AStarDrawManager::ResolveSkillFromDraw() const
 {
-	if (DirectionChoose.Num() == 0)
-	{
-		return ESkillType::None;
-	}
-
-	if (!CachedSkillAsset)
+	if (Session.GetTrail().Num() == 0)
 	{
 		return ESkillType::None;
 	}
 
-	return CachedSkillAsset->GetSkillTypeFromTrail(DirectionChoose);
+	// 绘制过程中已沿前缀树推进，直接取当前节点的技能
+	return Session.GetCompletedSkill();
 }
@@ -18,8 +18,8 @@ AStarDrawOtherStar::AStarDrawOtherStar()
 	SphereCollision = CreateDefaultSubobject<USphereComponent>(TEXT("SphereCollision"));
 	SetRootComponent(SphereCollision);
 	SphereCollision->SetSphereRadius(2.f);
-	SphereCollision->SetCollisionProfileName(CP_STAR_OTHER);
-	SphereCollision->SetGenerateOverlapEvents(true);
+	SphereCollision->SetCollisionProfileName(CP_NO_COLLISION);
+	SphereCollision->SetGenerateOverlapEvents(false);
 
 	Mesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 	Mesh->SetupAttachment(SphereCollision);
@@ -0,0 +1,273 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Skill/StarDrawSession.h"
+#include "Skill/StarDrawTrailTrie.h"
+
+void FStarDrawSession::Begin(const FVector& InPivot, const FVector& ControllerLocation, const FVector& Forward, float Distance, float InLineLength,
+	const FStarDrawTrailTrie* InTrie, bool bInPruneDeadCandidates)
+{
+	Reset();
+
+	Trie = InTrie;
+	TrieNode = Trie ? FStarDrawTrailTrie::RootNode : INDEX_NONE;
+	// 前缀树为空（没有配置任何轨迹）时不剔除，避免一颗候选星都没有
+	bPruneDeadCandidates = bInPruneDeadCandidates && Trie && Trie->GetNextDirectionMask(FStarDrawTrailTrie::RootNode) != 0;
+
+	Pivot = InPivot;
+	LineLength = InLineLength;
+	Radius = CalculateRadiusOnXY(Pivot, ControllerLocation, Forward, Distance);
+
+	// 蓝图：FingerPointLocation = ControllerLocation + Forward * Distance
+	FingerLocation = ControllerLocation + Forward * Distance;
+	PrevFingerLocation = FingerLocation;
+	bActive = true;
+
+	AddMainStar(FingerLocation);
+}
+
+void FStarDrawSession::Reset()
+{
+	MainStars.Reset();
+	Trail.Reset();
+	CandidateMask = 0;
+	Trie = nullptr;
+	TrieNode = INDEX_NONE;
+	bPruneDeadCandidates = false;
+	bActive = false;
+}
+
+void FStarDrawSession::UpdateFinger(const FVector& ControllerLocation, const FVector& Forward)
+{
+	PrevFingerLocation = FingerLocation;
+	FingerLocation = ProjectOntoCylinder(Pivot, ControllerLocation, Forward, Radius);
+}
+
+bool FStarDrawSession::FindTouchedCandidate(float TouchRadius, EStarDrawDirection& OutDirection) const
+{
+	if (CandidateMask == 0)
+	{
+		return false;
+	}
+
+	const float TouchRadiusSq = FMath::Square(TouchRadius);
+	const FVector Segment = FingerLocation - PrevFingerLocation;
+	const float SegmentLengthSq = Segment.SizeSquared();
+
+	int32 BestIndex = INDEX_NONE;
+	float BestAlpha = TNumericLimits<float>::Max();
+	float BestDistSq = TNumericLimits<float>::Max();
+
+	for (int32 Index = 0; Index < NumDirections; ++Index)
+	{
+		if ((CandidateMask & (1u << Index)) == 0)
+		{
+			continue;
+		}
+
+		// 候选点在线段上的投影参数（线段退化为点时取 0）
+		const FVector ToCandidate = Candidates[Index] - PrevFingerLocation;
+		const float Alpha = SegmentLengthSq > KINDA_SMALL_NUMBER
+			? FMath::Clamp(FVector::DotProduct(ToCandidate, Segment) / SegmentLengthSq, 0.0f, 1.0f)
+			: 0.0f;
+		const float DistSq = (ToCandidate - Segment * Alpha).SizeSquared();
+		if (DistSq > TouchRadiusSq)
+		{
+			continue;
+		}
+
+		if (Alpha < BestAlpha || (Alpha == BestAlpha && DistSq < BestDistSq))
+		{
+			BestIndex = Index;
+			BestAlpha = Alpha;
+			BestDistSq = DistSq;
+		}
+	}
+
+	if (BestIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutDirection = static_cast<EStarDrawDirection>(BestIndex);
+	return true;
+}
+
+bool FStarDrawSession::ConfirmCandidate(EStarDrawDirection Direction)
+{
+	if (!bActive || !IsCandidateActive(Direction))
+	{
+		return false;
+	}
+
+	// 蓝图：如果不是上一步的反方向才记录（避免来回抖动）
+	if (Trail.Num() > 0 && StarDrawDirectionGetOpposite(Direction) == Trail.Last())
+	{
+		return false;
+	}
+
+	Trail.Add(Direction);
+	if (Trie && TrieNode != INDEX_NONE)
+	{
+		TrieNode = Trie->Advance(TrieNode, Direction);
+	}
+	AddMainStar(GetCandidate(Direction));
+	return true;
+}
+
+uint8 FStarDrawSession::GetLiveCandidateMask() const
+{
+	if (!Trie)
+	{
+		return CandidateMask;
+	}
+	return CandidateMask & Trie->GetNextDirectionMask(TrieNode);
+}
+
+ESkillType FStarDrawSession::GetCompletedSkill() const
+{
+	return Trie ? Trie->GetSkill(TrieNode) : ESkillType::None;
+}
+
+uint32 FStarDrawSession::GetReachableSkillMask() const
+{
+	return Trie ? Trie->GetReachableSkillMask(TrieNode) : 0;
+}
+
+ESkillType FStarDrawSession::GetPredictedSkill() const
+{
+	return Trie ? Trie->GetPredictedSkill(TrieNode) : ESkillType::None;
+}
+
+void FStarDrawSession::AddMainStar(const FVector& Location)
+{
+	MainStars.Add(Location);
+
+	CandidateMask = 0;
+	if (!CalculateAdjacentPoints(Pivot, Location, LineLength, Candidates))
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < NumDirections; ++Index)
+	{
+		// 不生成上一步的反方向
+		const EStarDrawDirection Dir = static_cast<EStarDrawDirection>(Index);
+		if (Trail.Num() > 0 && StarDrawDirectionGetOpposite(Dir) == Trail.Last())
+		{
+			continue;
+		}
+		CandidateMask |= static_cast<uint8>(1u << Index);
+	}
+
+	if (bPruneDeadCandidates)
+	{
+		CandidateMask &= Trie->GetNextDirectionMask(TrieNode);
+	}
+}
+
+// ==================== 圆柱面几何 ====================
+
+float FStarDrawSession::CalculateRadiusOnXY(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float Distance)
+{
+	const FVector TargetLocation = ControllerLocation + Forward * Distance;
+	return FVector(TargetLocation.X - PlayerPivot.X, TargetLocation.Y - PlayerPivot.Y, 0.f).Size();
+}
+
+FVector FStarDrawSession::ProjectOntoCylinder(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float RadiusValue)
+{
+	// 目标：从 ControllerLocation 沿 Forward 发射射线 R(t)=ControllerLocation+Forward*t，
+	// 与以 PlayerPivot 为轴、半径 RadiusValue 的无限圆柱面（绕世界 Z 轴）求交。
+	// 圆柱面方程（XY 平面）：(x-PlayerPivot.X)^2 + (y-PlayerPivot.Y)^2 = RadiusValue^2。
+	// 将射线代入并仅用 XY 分量求解 t。
+
+	const FVector2D PivotXY(PlayerPivot.X, PlayerPivot.Y);
+	const FVector2D OriginXY(ControllerLocation.X, ControllerLocation.Y);
+	const FVector2D DirXY(Forward.X, Forward.Y);
+
+	const float DirLenSq = DirXY.SquaredLength();
+	if (DirLenSq <= KINDA_SMALL_NUMBER)
+	{
+		// 射线几乎与圆柱轴平行（Forward XY 分量接近 0），无法与圆柱面稳定求交。
+		// 这里保持当前位置（不回退到某个错误的交点）。
+		return ControllerLocation;
+	}
+
+	const FVector2D Delta = OriginXY - PivotXY;
+
+	// 解二次方程：a t^2 + b t + c = 0
+	// a = dx^2 + dy^2
+	// b = 2 * (dx*(ox-px) + dy*(oy-py))
+	// c = (ox-px)^2 + (oy-py)^2 - r^2
+	const float A = DirLenSq;
+	const float B = 2.f * FVector2D::DotProduct(DirXY, Delta);
+	const float C = Delta.SquaredLength() - RadiusValue * RadiusValue;
+
+	const float Discriminant = B * B - 4.f * A * C;
+	if (Discriminant < 0.f)
+	{
+		// 无实根：射线在 XY 上不与圆柱面相交
+		return ControllerLocation;
+	}
+
+	const float SqrtD = FMath::Sqrt(Discriminant);
+	const float Inv2A = 1.f / (2.f * A);
+	const float t0 = (-B - SqrtD) * Inv2A;
+	const float t1 = (-B + SqrtD) * Inv2A;
+
+	// 选择最小的正根（最近的前向交点）
+	float t = TNumericLimits<float>::Max();
+	if (t0 >= 0.f)
+	{
+		t = t0;
+	}
+	if (t1 >= 0.f)
+	{
+		t = FMath::Min(t, t1);
+	}
+
+	if (t == TNumericLimits<float>::Max())
+	{
+		// 两个根都在射线反方向
+		return ControllerLocation;
+	}
+
+	return ControllerLocation + Forward * t;
+}
+
+bool FStarDrawSession::CalculateAdjacentPoints(const FVector& PlayerPivot, const FVector& CenterLocation, float InLineLength, FVector (&OutPoints)[NumDirections])
+{
+	// 对齐 Z（在蓝图库里 PlayerLocation.Z=StarLocation.Z）
+	FVector PlayerFlat = PlayerPivot;
+	PlayerFlat.Z = CenterLocation.Z;
+
+	const FVector OriginalVector = CenterLocation - PlayerFlat;
+	const float RadiusLocal = FVector(OriginalVector.X, OriginalVector.Y, 0.f).Size();
+	if (RadiusLocal <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// Zita = acos((2R^2 - L^2) / (2R^2))
+	const float CosValue = (2.f * RadiusLocal * RadiusLocal - InLineLength * InLineLength) / (2.f * RadiusLocal * RadiusLocal);
+	const float ClampedCos = FMath::Clamp(CosValue, -1.f, 1.f);
+	const float ZitaDeg = FMath::RadiansToDegrees(FMath::Acos(ClampedCos));
+
+	FVector OriginalFlat = OriginalVector;
+	OriginalFlat.Z = 0.f;
+
+	const FVector LeftPoint = PlayerFlat + OriginalFlat.RotateAngleAxis(-ZitaDeg, FVector::UpVector);
+	const FVector RightPoint = PlayerFlat + OriginalFlat.RotateAngleAxis(ZitaDeg, FVector::UpVector);
+
+	const FVector UpVector = FVector(0, 0, InLineLength);
+	const FVector DownVector = FVector(0, 0, -InLineLength);
+
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::Left)] = LeftPoint;
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::Right)] = RightPoint;
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::Up)] = CenterLocation + UpVector;
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::Down)] = CenterLocation + DownVector;
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::LeftUp)] = LeftPoint + UpVector;
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::RightUp)] = RightPoint + UpVector;
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::LeftDown)] = LeftPoint + DownVector;
+	OutPoints[StarDrawDirectionToInt(EStarDrawDirection::RightDown)] = RightPoint + DownVector;
+	return true;
+}
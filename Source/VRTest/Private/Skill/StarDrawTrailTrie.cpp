@@ -0,0 +1,140 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Skill/StarDrawTrailTrie.h"
+
+namespace StarDrawTrailTrie
+{
+	FORCEINLINE uint32 SkillBit(ESkillType Skill)
+	{
+		return Skill == ESkillType::None ? 0u : (1u << static_cast<uint32>(Skill));
+	}
+}
+
+void FStarDrawTrailTrie::Reset()
+{
+	Nodes.Reset();
+	Nodes.AddDefaulted();
+}
+
+bool FStarDrawTrailTrie::Add(TConstArrayView<EStarDrawDirection> Trail, ESkillType Skill, ESkillType& OutReplaced)
+{
+	OutReplaced = ESkillType::None;
+	if (Trail.Num() == 0)
+	{
+		return false;
+	}
+
+	int32 Node = RootNode;
+	for (const EStarDrawDirection Dir : Trail)
+	{
+		const int32 DirIndex = StarDrawDirectionToInt(Dir);
+		int32 Child = Nodes[Node].Children[DirIndex];
+		if (Child == INDEX_NONE)
+		{
+			// 先 Add 再取下标：Add 可能重新分配 Nodes
+			Child = Nodes.AddDefaulted();
+			Nodes[Node].Children[DirIndex] = Child;
+			Nodes[Node].ChildMask |= static_cast<uint8>(1u << DirIndex);
+		}
+		Node = Child;
+	}
+
+	OutReplaced = Nodes[Node].Skill;
+	Nodes[Node].Skill = Skill;
+
+	if (OutReplaced == ESkillType::None)
+	{
+		// 没有覆盖旧技能：沿路径把新技能标记为可达即可
+		const uint32 Bit = StarDrawTrailTrie::SkillBit(Skill);
+		int32 PathNode = RootNode;
+		Nodes[PathNode].ReachableSkills |= Bit;
+		for (const EStarDrawDirection Dir : Trail)
+		{
+			PathNode = Nodes[PathNode].Children[StarDrawDirectionToInt(Dir)];
+			Nodes[PathNode].ReachableSkills |= Bit;
+		}
+	}
+	else
+	{
+		RebuildReachableSkills();
+	}
+
+	return true;
+}
+
+void FStarDrawTrailTrie::RebuildReachableSkills()
+{
+	// 子节点下标总是大于父节点，倒序遍历即可自底向上汇总
+	for (int32 Index = Nodes.Num() - 1; Index >= 0; --Index)
+	{
+		FNode& Node = Nodes[Index];
+		Node.ReachableSkills = StarDrawTrailTrie::SkillBit(Node.Skill);
+		for (const int32 Child : Node.Children)
+		{
+			if (Child != INDEX_NONE)
+			{
+				Node.ReachableSkills |= Nodes[Child].ReachableSkills;
+			}
+		}
+	}
+}
+
+int32 FStarDrawTrailTrie::Advance(int32 Node, EStarDrawDirection Direction) const
+{
+	return Nodes.IsValidIndex(Node) ? Nodes[Node].Children[StarDrawDirectionToInt(Direction)] : INDEX_NONE;
+}
+
+ESkillType FStarDrawTrailTrie::Find(TConstArrayView<EStarDrawDirection> Trail) const
+{
+	if (Trail.Num() == 0)
+	{
+		return ESkillType::None;
+	}
+
+	int32 Node = RootNode;
+	for (const EStarDrawDirection Dir : Trail)
+	{
+		Node = Advance(Node, Dir);
+		if (Node == INDEX_NONE)
+		{
+			return ESkillType::None;
+		}
+	}
+	return GetSkill(Node);
+}
+
+ESkillType FStarDrawTrailTrie::GetSkill(int32 Node) const
+{
+	return Nodes.IsValidIndex(Node) ? Nodes[Node].Skill : ESkillType::None;
+}
+
+uint8 FStarDrawTrailTrie::GetNextDirectionMask(int32 Node) const
+{
+	return Nodes.IsValidIndex(Node) ? Nodes[Node].ChildMask : 0;
+}
+
+uint32 FStarDrawTrailTrie::GetReachableSkillMask(int32 Node) const
+{
+	return Nodes.IsValidIndex(Node) ? Nodes[Node].ReachableSkills : 0;
+}
+
+ESkillType FStarDrawTrailTrie::GetPredictedSkill(int32 Node) const
+{
+	const uint32 Mask = GetReachableSkillMask(Node);
+	if (Mask == 0 || !FMath::IsPowerOfTwo(Mask))
+	{
+		return ESkillType::None;
+	}
+	return static_cast<ESkillType>(FMath::CountTrailingZeros(Mask));
+}
+
+void FStarDrawTrailTrie::SkillMaskToArray(uint32 SkillMask, TArray<ESkillType>& OutSkills)
+{
+	OutSkills.Reset();
+	while (SkillMask != 0)
+	{
+		const uint32 Bit = FMath::CountTrailingZeros(SkillMask);
+		OutSkills.Add(static_cast<ESkillType>(Bit));
+		SkillMask &= SkillMask - 1;
+	}
+}
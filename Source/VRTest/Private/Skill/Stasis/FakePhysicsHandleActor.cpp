@@ -2,15 +2,14 @@
 
 
 #include "Skill/Stasis/FakePhysicsHandleActor.h"
-#include "Engine/Engine.h"
-#include "Math/UnrealMathUtility.h"
+#include "Skill/Stasis/FakePhysicsSubsystem.h"
 
 
 // Sets default values
 AFakePhysicsHandleActor::AFakePhysicsHandleActor()
 {
- 	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
-	PrimaryActorTick.bCanEverTick = true;
+	// 位置由 UFakePhysicsSubsystem 批量更新，自身不 Tick
+	PrimaryActorTick.bCanEverTick = false;
 
 }
 
@@ -18,28 +17,17 @@ AFakePhysicsHandleActor::AFakePhysicsHandleActor()
 void AFakePhysicsHandleActor::BeginPlay()
 {
 	Super::BeginPlay();
-	CurrentVelocity = FVector::ZeroVector;
 }
 
-// Called every frame
-void AFakePhysicsHandleActor::Tick(float DeltaTime)
+void AFakePhysicsHandleActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
-
-	if (Simulating)
+	if (UFakePhysicsSubsystem* Subsystem = UFakePhysicsSubsystem::Get(this))
 	{
-		FVector CurrentLocation = GetActorLocation();
-		FVector Direction = TargetLocation - CurrentLocation;
-		float Length = Direction.Size();
-		Direction.Normalize();
-		Length = FMath::Clamp(Length, SpringForceMin,SpringForceMax );
-		FVector Force = Direction * SpringStiffness * Length - CurrentVelocity * Damping;
-		CurrentVelocity += Force * DeltaTime;
-		CurrentLocation += CurrentVelocity * DeltaTime;
-        
-		SetActorLocation(CurrentLocation);
+		Subsystem->Unregister(this);
 	}
+	Simulating = false;
 
+	Super::EndPlay(EndPlayReason);
 }
 
 void AFakePhysicsHandleActor::SetTargetLocation(const FVector& NewTargetLocation)
@@ -47,15 +35,42 @@ void AFakePhysicsHandleActor::SetTargetLocation(const FVector& NewTargetLocation
 	TargetLocation = NewTargetLocation;
 }
 
+void AFakePhysicsHandleActor::SetCurrentVelocity(const FVector& NewVelocity)
+{
+	UFakePhysicsSubsystem* Subsystem = UFakePhysicsSubsystem::Get(this);
+	if (Simulating && Subsystem && Subsystem->SetVelocity(this, NewVelocity))
+	{
+		return;
+	}
+
+	// 还没开始模拟：记下，StartSimulate 时生效
+	PendingVelocity = NewVelocity;
+}
+
+FVector AFakePhysicsHandleActor::GetCurrentVelocity() const
+{
+	const UFakePhysicsSubsystem* Subsystem = UFakePhysicsSubsystem::Get(this);
+	return Simulating && Subsystem ? Subsystem->GetVelocity(this) : PendingVelocity;
+}
+
 void AFakePhysicsHandleActor::StartSimulate()
 {
-	Simulating = true;
-	CurrentVelocity = FVector::ZeroVector; // 重置速度
+	if (UFakePhysicsSubsystem* Subsystem = UFakePhysicsSubsystem::Get(this))
+	{
+		// 注册时从当前位置开始，初速度取未模拟时设置的值
+		Subsystem->Register(this);
+		Subsystem->SetVelocity(this, PendingVelocity);
+		PendingVelocity = FVector::ZeroVector;
+		Simulating = true;
+	}
 }
 
 void AFakePhysicsHandleActor::StopSimulate()
 {
+	if (UFakePhysicsSubsystem* Subsystem = UFakePhysicsSubsystem::Get(this))
+	{
+		Subsystem->Unregister(this);
+	}
 	Simulating = false;
-	CurrentVelocity = FVector::ZeroVector;
+	PendingVelocity = FVector::ZeroVector;
 }
-
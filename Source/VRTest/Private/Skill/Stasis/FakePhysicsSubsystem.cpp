@@ -0,0 +1,298 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Skill/Stasis/FakePhysicsSubsystem.h"
+#include "Skill/Stasis/FakePhysicsHandleActor.h"
+#include "Skill/Stasis/StasisPoint.h"
+#include "Game/VRTestStats.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+namespace FakePhysics
+{
+	/** 与 FProjectileSimParams 默认值一致：所有条目共用 */
+	const FProjectileSimParams DefaultParams;
+
+	FAutoConsoleCommandWithWorldAndArgs StressCommand(
+		TEXT("VRTest.FakePhysics.Stress"),
+		TEXT("在玩家周围生成 N 个定身球追踪随机目标（N=0 清除）。用法：VRTest.FakePhysics.Stress <N> [Radius]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			UFakePhysicsSubsystem* Subsystem = World ? World->GetSubsystem<UFakePhysicsSubsystem>() : nullptr;
+			if (!Subsystem)
+			{
+				return;
+			}
+
+			const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 200;
+			const float Radius = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1000.0f;
+
+			FVector Center = FVector::ZeroVector;
+			if (const APlayerController* PC = World->GetFirstPlayerController())
+			{
+				if (const APawn* Pawn = PC->GetPawn())
+				{
+					Center = Pawn->GetActorLocation();
+				}
+			}
+
+			Subsystem->RunStressTest(Count, Center, Radius);
+		}));
+}
+
+UFakePhysicsSubsystem* UFakePhysicsSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UFakePhysicsSubsystem>() : nullptr;
+}
+
+bool UFakePhysicsSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFakePhysicsSubsystem::Deinitialize()
+{
+	Handles.Reset();
+	HandleKeys.Reset();
+	States.Reset();
+	Params.Reset();
+	RenderedLocations.Reset();
+	IndexByHandle.Reset();
+	StressActors.Reset();
+	TimeAccumulator = 0.0f;
+
+	Super::Deinitialize();
+}
+
+bool UFakePhysicsSubsystem::IsTickable() const
+{
+	// 没有条目时不 Tick
+	return Handles.Num() > 0;
+}
+
+TStatId UFakePhysicsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFakePhysicsSubsystem, STATGROUP_Tickables);
+}
+
+void UFakePhysicsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_VRTest_FakePhysicsUpdate);
+	SET_DWORD_STAT(STAT_VRTest_FakePhysicsHandles, Handles.Num());
+
+	// 本帧步数：所有条目共用，累积与追帧上限同 FProjectileSimulation::Advance
+	const float FixedStep = FakePhysics::DefaultParams.FixedTimeStep;
+	const int32 MaxSteps = FakePhysics::DefaultParams.MaxStepsPerAdvance;
+	TimeAccumulator += FMath::Max(DeltaTime, 0.0f);
+
+	int32 Steps = 0;
+	while (TimeAccumulator >= FixedStep && Steps < MaxSteps)
+	{
+		TimeAccumulator -= FixedStep;
+		++Steps;
+	}
+
+	// 追帧上限：丢弃剩余时间，保证单帧开销有界
+	if (Steps >= MaxSteps)
+	{
+		TimeAccumulator = FMath::Min(TimeAccumulator, FixedStep);
+	}
+
+	// 渲染插值系数：本帧没有新步时也要写回，位置才会随时间平滑推进
+	const float Alpha = FMath::Clamp(TimeAccumulator / FixedStep, 0.0f, 1.0f);
+
+	// 1) 读取：位置（可能被外部移动）、目标与弹簧参数
+	for (int32 Index = Handles.Num() - 1; Index >= 0; --Index)
+	{
+		const AFakePhysicsHandleActor* Handle = Handles[Index].Get();
+		if (!Handle)
+		{
+			RemoveAt(Index);
+			continue;
+		}
+
+		if (const USceneComponent* Tracked = Handle->GetTrackedComponent())
+		{
+			Params[Index].HomingTarget = Tracked->GetComponentLocation();
+		}
+		else
+		{
+			Params[Index].HomingTarget = Handle->TargetLocation;
+		}
+		Params[Index].HomingStiffness = Handle->SpringStiffness;
+		Params[Index].HomingDamping = Handle->Damping;
+		Params[Index].HomingDistanceMin = Handle->SpringForceMin;
+		Params[Index].HomingDistanceMax = Handle->SpringForceMax;
+
+		const FVector ActorLocation = Handle->GetActorLocation();
+		if (!ActorLocation.Equals(RenderedLocations[Index], KINDA_SMALL_NUMBER))
+		{
+			States[Index].SetCurrent(ActorLocation, States[Index].Velocity);
+		}
+	}
+
+	// 2) 积分：只访问紧凑数组
+	const int32 Num = States.Num();
+	for (int32 Step = 0; Step < Steps; ++Step)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			FProjectileSimulation::Step(States[Index], Params[Index]);
+		}
+	}
+
+	// 3) 写回（会触发 Overlap，定身球靠它命中目标；Overlap 回调里可能注销/销毁 Actor，
+	//    注销只清空条目，写回结束后统一移除；回调里新注册的条目追加在末尾，本帧不写回）
+	bWritingBack = true;
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		if (AFakePhysicsHandleActor* Handle = Handles[Index].Get())
+		{
+			RenderedLocations[Index] = FProjectileSimulation::InterpolateLocation(States[Index], Alpha);
+			Handle->SetActorLocation(RenderedLocations[Index]);
+		}
+	}
+	bWritingBack = false;
+
+	for (int32 Index = Handles.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Handles[Index].IsValid())
+		{
+			RemoveAt(Index);
+		}
+	}
+}
+
+// ==================== 注册 ====================
+
+void UFakePhysicsSubsystem::Register(AFakePhysicsHandleActor* Handle)
+{
+	if (!IsValid(Handle))
+	{
+		return;
+	}
+
+	const FObjectKey Key(Handle);
+	int32 Index;
+	if (const int32* Found = IndexByHandle.Find(Key))
+	{
+		// 可能是写回过程中刚注销、尚未移除的条目
+		Index = *Found;
+		Handles[Index] = Handle;
+	}
+	else
+	{
+		Index = Handles.Add(Handle);
+		HandleKeys.Add(Key);
+		States.AddDefaulted();
+		Params.Add(FakePhysics::DefaultParams);
+		Params[Index].bHoming = true;
+		RenderedLocations.AddDefaulted();
+		IndexByHandle.Add(Key, Index);
+	}
+
+	States[Index] = FProjectileSimState(Handle->GetActorLocation(), FVector::ZeroVector);
+	RenderedLocations[Index] = Handle->GetActorLocation();
+}
+
+void UFakePhysicsSubsystem::Unregister(const AFakePhysicsHandleActor* Handle)
+{
+	const int32* Found = Handle ? IndexByHandle.Find(FObjectKey(Handle)) : nullptr;
+	if (!Found)
+	{
+		return;
+	}
+
+	if (bWritingBack)
+	{
+		Handles[*Found].Reset();
+		return;
+	}
+	RemoveAt(*Found);
+}
+
+bool UFakePhysicsSubsystem::SetVelocity(const AFakePhysicsHandleActor* Handle, const FVector& Velocity)
+{
+	const int32* Found = Handle ? IndexByHandle.Find(FObjectKey(Handle)) : nullptr;
+	if (!Found)
+	{
+		return false;
+	}
+
+	States[*Found].Velocity = Velocity;
+	return true;
+}
+
+FVector UFakePhysicsSubsystem::GetVelocity(const AFakePhysicsHandleActor* Handle) const
+{
+	const int32* Found = Handle ? IndexByHandle.Find(FObjectKey(Handle)) : nullptr;
+	return Found ? States[*Found].Velocity : FVector::ZeroVector;
+}
+
+void UFakePhysicsSubsystem::RemoveAt(int32 Index)
+{
+	IndexByHandle.Remove(HandleKeys[Index]);
+
+	const int32 LastIndex = Handles.Num() - 1;
+	if (Index != LastIndex)
+	{
+		IndexByHandle.Add(HandleKeys[LastIndex], Index);
+	}
+
+	Handles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	HandleKeys.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	States.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	Params.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	RenderedLocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+// ==================== 压力测试 ====================
+
+void UFakePhysicsSubsystem::RunStressTest(int32 Count, const FVector& Center, float Radius)
+{
+	for (const TWeakObjectPtr<AActor>& Actor : StressActors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->Destroy();
+		}
+	}
+	StressActors.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World || Count <= 0)
+	{
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	StressActors.Reserve(Count);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector SpawnLocation = Center + FMath::VRand() * FMath::FRandRange(0.0f, Radius);
+		AStasisPoint* Point = World->SpawnActor<AStasisPoint>(AStasisPoint::StaticClass(), SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+		if (!Point)
+		{
+			continue;
+		}
+
+		// 追踪模式飞向随机点（BeginPlay 中已注册）
+		Point->EnterTrackMode();
+		Point->SetTargetLocation(Center + FMath::VRand() * Radius);
+		Point->SetCurrentVelocity(FMath::VRand() * 500.0f);
+		StressActors.Add(Point);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("FakePhysics: stress test spawned %d handles (total registered %d)"), StressActors.Num(), Handles.Num());
+}
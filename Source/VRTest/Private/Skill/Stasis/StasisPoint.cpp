@@ -4,16 +4,18 @@
 
 #include "Game/GameSettings.h"
 #include "Grabber/PlayerGrabHand.h"
+#include "Grabber/GrabbableRegistrySubsystem.h"
 #include "Skill/SkillAsset.h"
 #include "Skill/Stasis/IStasisable.h"
+#include "Skill/Stasis/StasisableRegistrySubsystem.h"
+#include "Skill/Stasis/StasisSubsystem.h"
 #include "Game/CollisionConfig.h"
-#include "Game/GameUtils.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
 
 AStasisPoint::AStasisPoint()
 {
-    PrimaryActorTick.bCanEverTick = true;
+    // 追踪由 UFakePhysicsSubsystem 批量积分
+    PrimaryActorTick.bCanEverTick = false;
 
     // Create Sphere component
     Sphere = CreateDefaultSubobject<USphereComponent>(TEXT("Sphere"));
@@ -29,12 +31,6 @@ AStasisPoint::AStasisPoint()
     Target = nullptr;
     TimeToStasis = 0.0f;
 
-    // 定身目标检测默认 ObjectTypes：WorldDynamic + Pawn
-    TargetingObjectTypes = {
-        UEngineTypes::ConvertToObjectType(ECC_WorldDynamic),
-        UEngineTypes::ConvertToObjectType(ECC_PhysicsBody)
-    };
-
     // Initialize physics parameters
     SpringStiffness = 1000.0f;
     Damping = 100.0f;
@@ -66,17 +62,23 @@ void AStasisPoint::BeginPlay()
     {
         Sphere->OnComponentBeginOverlap.AddDynamic(this, &AStasisPoint::OnSphereBeginOverlap);
     }
+
+    UGrabbableRegistrySubsystem::RegisterGrabbable(this);
 }
 
-void AStasisPoint::Tick(float DeltaTime)
+void AStasisPoint::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    Super::Tick(DeltaTime);
-
-    // Update target location if valid
-    if (Target && Target->IsValidLowLevel())
+    if (UStasisSubsystem* Stasis = UStasisSubsystem::Get(this))
     {
-        SetTargetLocation(Target->GetComponentLocation());
+        Stasis->CancelScheduledDestroy(this);
     }
+    UGrabbableRegistrySubsystem::UnregisterGrabbable(this);
+    Super::EndPlay(EndPlayReason);
+}
+
+const USceneComponent* AStasisPoint::GetTrackedComponent() const
+{
+    return IsValid(Target) ? Target : nullptr;
 }
 
 AActor* AStasisPoint::FindStasisTarget(
@@ -87,39 +89,14 @@ AActor* AStasisPoint::FindStasisTarget(
     float DetectionAngleDegrees,
     const TArray<AActor*>& IgnoreActors) const
 {
-    // 复用现有 GameUtils：SphereOverlap + 角度排序
-    const TArray<FActorWithAngle> ActorsInCone = UGameUtils::FindActorsInCone(
-        WorldContextObject,
-        Origin,
-        AimDirection,
-        DetectionRadius,
-        DetectionAngleDegrees,
-        TargetingObjectTypes,
-        IgnoreActors
-    );
-
-    for (const FActorWithAngle& Item : ActorsInCone)
+    // 只在已注册的可定身物中查找（不做场景 Overlap），按夹角从小到大取第一个 CanEnterStasis 的目标
+    UStasisableRegistrySubsystem* Registry = UStasisableRegistrySubsystem::Get(WorldContextObject ? WorldContextObject : this);
+    if (!Registry)
     {
-        AActor* Actor = Item.Actor;
-        if (!Actor)
-        {
-            continue;
-        }
-
-        if (!Actor->GetClass()->ImplementsInterface(UStasisable::StaticClass()))
-        {
-            continue;
-        }
-
-        if (!IStasisable::Execute_CanEnterStasis(Actor))
-        {
-            continue;
-        }
-
-        return Actor;
+        return nullptr;
     }
 
-    return nullptr;
+    return Registry->FindBestTarget(Origin, AimDirection, DetectionRadius, DetectionAngleDegrees, IgnoreActors);
 }
 
 void AStasisPoint::StartNoTargetFlight(const FVector& Origin, const FVector& AimDirection, float MaxNoTargetDistance, float NoTargetLifeSeconds)
@@ -129,19 +106,12 @@ void AStasisPoint::StartNoTargetFlight(const FVector& Origin, const FVector& Aim
 
     SetTargetLocation(Origin + (FallbackDir * MaxNoTargetDistance));
 
-    // 超时自毁：避免无限飞行常驻
+    // 超时自毁：避免无限飞行常驻（由定身管理的时间轮统一驱动）
     if (NoTargetLifeSeconds > 0.0f)
     {
-        if (UWorld* World = GetWorld())
+        if (UStasisSubsystem* Stasis = UStasisSubsystem::Get(this))
         {
-            World->GetTimerManager().ClearTimer(NoTargetDestroyTimerHandle);
-            World->GetTimerManager().SetTimer(
-                NoTargetDestroyTimerHandle,
-                this,
-                &AActor::K2_DestroyActor,
-                NoTargetLifeSeconds,
-                false
-            );
+            Stasis->ScheduleDestroy(this, NoTargetLifeSeconds);
         }
     }
 }
@@ -167,9 +137,9 @@ void AStasisPoint::Fire(
     SetCurrentVelocity(InitVelocity);
 
     // Fire 时不再依赖 Held 逻辑；若有旧的超时任务，清掉
-    if (UWorld* World = GetWorld())
+    if (UStasisSubsystem* Stasis = UStasisSubsystem::Get(this))
     {
-        World->GetTimerManager().ClearTimer(NoTargetDestroyTimerHandle);
+        Stasis->CancelScheduledDestroy(this);
     }
 
     // 由定身球内部选目标
@@ -244,12 +214,12 @@ bool AStasisPoint::SupportsDualHandGrab_Implementation() const
     return false;
 }
 
-void AStasisPoint::OnGrabSelected_Implementation()
+void AStasisPoint::OnGrabSelected_Implementation(UPlayerGrabHand* Hand)
 {
     // StasisPoint 不支持重力手套选中
 }
 
-void AStasisPoint::OnGrabDeselected_Implementation()
+void AStasisPoint::OnGrabDeselected_Implementation(UPlayerGrabHand* Hand)
 {
     // StasisPoint 不支持重力手套选中
 }
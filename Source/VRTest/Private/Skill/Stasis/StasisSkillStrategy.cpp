@@ -4,6 +4,7 @@
 #include "Skill/Stasis/StasisPoint.h"
 #include "Skill/Stasis/VRStasisFireMonitor.h"
 #include "Game/Characters/BasePlayer.h"
+#include "Game/GameSettings.h"
 #include "Game/ShujiGameMode.h"
 #include "Grabber/PlayerGrabHand.h"
 #include "Skill/SkillTypes.h"
@@ -17,6 +18,23 @@ AStasisSkillStrategy::AStasisSkillStrategy()
 	VRFireMonitorClass = AVRStasisFireMonitor::StaticClass();
 }
 
+void AStasisSkillStrategy::GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	Super::GetPreloadAssets(OutAssets);
+
+	if (StasisPointClass)
+	{
+		OutAssets.AddUnique(FSoftObjectPath(StasisPointClass.Get()));
+	}
+
+	// 定身球的 Niagara 特效由 SkillAsset 硬引用，加载 SkillAsset 即一并加载
+	const UGameSettings* Settings = UGameSettings::Get();
+	if (Settings && !Settings->SkillAsset.IsNull())
+	{
+		OutAssets.AddUnique(Settings->SkillAsset.ToSoftObjectPath());
+	}
+}
+
 bool AStasisSkillStrategy::Execute_Implementation(ABasePlayer* Player, const FSkillContext& Context)
 {
 	if (!Player || !Context.InputSource)
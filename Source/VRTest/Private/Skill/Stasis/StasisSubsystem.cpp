@@ -0,0 +1,395 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Skill/Stasis/StasisSubsystem.h"
+#include "Skill/Stasis/IStasisable.h"
+#include "Game/GameSettings.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+namespace StasisSystem
+{
+	/** 定身中的时间膨胀：动画/移动/Tick 全部停住 */
+	constexpr float FrozenTimeDilation = 0.0f;
+
+	/** 每个目标最多记录的冲量条数，超出后合并到同一物理体的已有记录 */
+	constexpr int32 MaxStoredImpulses = 16;
+}
+
+UStasisSubsystem* UStasisSubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UStasisSubsystem>() : nullptr;
+}
+
+bool UStasisSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStasisSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TimerWheel.Reset(InWorld.GetTimeSeconds());
+}
+
+void UStasisSubsystem::Deinitialize()
+{
+	Entries.Reset();
+	StoredImpulses.Reset();
+	IndexByActor.Reset();
+	PendingDestroys.Reset();
+	ExpiredTimers.Reset();
+	TimerWheel.Reset(0.0);
+
+	Super::Deinitialize();
+}
+
+void UStasisSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	PruneStaleEntries();
+	ProcessExpired();
+}
+
+bool UStasisSubsystem::IsTickable() const
+{
+	// 没有定时、也没有定身目标时不 Tick
+	return TimerWheel.Num() > 0 || Entries.Num() > 0;
+}
+
+TStatId UStasisSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UStasisSubsystem, STATGROUP_Tickables);
+}
+
+// ==================== 定身 ====================
+
+bool UStasisSubsystem::Freeze(AActor* Target, float Duration)
+{
+	if (!IsValid(Target))
+	{
+		return false;
+	}
+
+	if (const int32* Found = IndexByActor.Find(FObjectKey(Target)))
+	{
+		// 已在定身中：只刷新时长（旧定时按编号作废）
+		FStasisEntry& Entry = Entries[*Found];
+		Entry.TimerId = Duration > 0.0f
+			? TimerWheel.Schedule(GetWorld()->GetTimeSeconds() + Duration, Entry.Key, static_cast<uint8>(ETimerTag::Release))
+			: 0;
+		return true;
+	}
+
+	FreezeNew(Target, Duration);
+	return true;
+}
+
+int32 UStasisSubsystem::FreezeBatch(TConstArrayView<AActor*> Targets, float Duration)
+{
+	Entries.Reserve(Entries.Num() + Targets.Num());
+	StoredImpulses.Reserve(StoredImpulses.Num() + Targets.Num());
+
+	int32 FrozenCount = 0;
+	for (AActor* Target : Targets)
+	{
+		if (Freeze(Target, Duration))
+		{
+			++FrozenCount;
+		}
+	}
+	return FrozenCount;
+}
+
+void UStasisSubsystem::FreezeNew(AActor* Target, float Duration)
+{
+	const int32 Index = Entries.AddDefaulted();
+	StoredImpulses.AddDefaulted();
+
+	FStasisEntry& Entry = Entries[Index];
+	Entry.Actor = Target;
+	Entry.Key = FObjectKey(Target);
+	Entry.PrevTimeDilation = Target->CustomTimeDilation;
+	IndexByActor.Add(Entry.Key, Index);
+
+	Target->CustomTimeDilation = StasisSystem::FrozenTimeDilation;
+
+	// 只处理正在模拟的 Primitive：记下速度后转为运动学，碰撞保持不变
+	Target->ForEachComponent<UPrimitiveComponent>(false, [&Entry](UPrimitiveComponent* Primitive)
+	{
+		if (!Primitive->IsSimulatingPhysics())
+		{
+			return;
+		}
+
+		FFrozenBody& Body = Entry.Bodies.AddDefaulted_GetRef();
+		Body.Primitive = Primitive;
+		Body.LinearVelocity = Primitive->GetPhysicsLinearVelocity();
+		Body.AngularVelocityDeg = Primitive->GetPhysicsAngularVelocityInDegrees();
+		Primitive->SetSimulatePhysics(false);
+	});
+
+	if (Duration > 0.0f)
+	{
+		Entry.TimerId = TimerWheel.Schedule(GetWorld()->GetTimeSeconds() + Duration, Entry.Key, static_cast<uint8>(ETimerTag::Release));
+	}
+}
+
+bool UStasisSubsystem::Release(AActor* Target, bool bApplyStoredMomentum)
+{
+	const int32* Found = Target ? IndexByActor.Find(FObjectKey(Target)) : nullptr;
+	if (!Found)
+	{
+		return false;
+	}
+
+	ReleaseAt(*Found, bApplyStoredMomentum);
+	return true;
+}
+
+void UStasisSubsystem::ReleaseAt(int32 Index, bool bApplyStoredMomentum)
+{
+	FStasisEntry& Entry = Entries[Index];
+
+	if (AActor* Actor = Entry.Actor.Get())
+	{
+		Actor->CustomTimeDilation = Entry.PrevTimeDilation;
+
+		const UGameSettings* Settings = UGameSettings::Get();
+		const float MaxReleaseSpeed = Settings ? Settings->StasisMaxReleaseSpeed : 0.0f;
+
+		UPrimitiveComponent* FirstBody = nullptr;
+		for (const FFrozenBody& Body : Entry.Bodies)
+		{
+			UPrimitiveComponent* Primitive = Body.Primitive.Get();
+			if (!Primitive)
+			{
+				continue;
+			}
+
+			Primitive->SetSimulatePhysics(true);
+			if (!bApplyStoredMomentum)
+			{
+				continue;
+			}
+
+			Primitive->SetPhysicsLinearVelocity(Body.LinearVelocity);
+			Primitive->SetPhysicsAngularVelocityInDegrees(Body.AngularVelocityDeg);
+			if (!FirstBody)
+			{
+				FirstBody = Primitive;
+			}
+		}
+
+		// 冲量施加到命中的物理体（命中组件没有在模拟时退回第一个模拟体），作用点/骨骼保持不变
+		TArray<UPrimitiveComponent*, TInlineAllocator<2>> ImpulsedBodies;
+		if (bApplyStoredMomentum)
+		{
+			for (const FStoredImpulse& Stored : StoredImpulses[Index])
+			{
+				UPrimitiveComponent* Primitive = Stored.Primitive.Get();
+				FName BoneName = Stored.BoneName;
+				if (!Primitive || !Primitive->IsSimulatingPhysics(BoneName))
+				{
+					Primitive = FirstBody;
+					BoneName = NAME_None;
+				}
+				if (!Primitive || Stored.Impulse.IsNearlyZero())
+				{
+					continue;
+				}
+
+				if (Stored.bAtLocation)
+				{
+					Primitive->AddImpulseAtLocation(Stored.Impulse, Stored.Location, BoneName);
+				}
+				else
+				{
+					Primitive->AddImpulse(Stored.Impulse, BoneName);
+				}
+				ImpulsedBodies.AddUnique(Primitive);
+			}
+		}
+
+		if (MaxReleaseSpeed > 0.0f)
+		{
+			for (UPrimitiveComponent* Primitive : ImpulsedBodies)
+			{
+				const FVector Velocity = Primitive->GetPhysicsLinearVelocity();
+				if (Velocity.SizeSquared() > FMath::Square(MaxReleaseSpeed))
+				{
+					Primitive->SetPhysicsLinearVelocity(Velocity.GetSafeNormal() * MaxReleaseSpeed);
+				}
+			}
+		}
+	}
+
+	// 交换删除，修正被移动条目的下标
+	IndexByActor.Remove(Entry.Key);
+	const int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex)
+	{
+		IndexByActor.Add(Entries[LastIndex].Key, Index);
+	}
+	Entries.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	StoredImpulses.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+}
+
+bool UStasisSubsystem::IsFrozen(const AActor* Target) const
+{
+	return Target && IndexByActor.Contains(FObjectKey(Target));
+}
+
+bool UStasisSubsystem::AddStoredImpulse(AActor* Target, const FVector& Impulse)
+{
+	const int32* Found = Target ? IndexByActor.Find(FObjectKey(Target)) : nullptr;
+	if (!Found)
+	{
+		return false;
+	}
+
+	FStoredImpulse Stored;
+	Stored.Impulse = Impulse;
+	StoreImpulse(*Found, Stored);
+	return true;
+}
+
+bool UStasisSubsystem::AddStoredImpulseAtLocation(UPrimitiveComponent* HitComponent, const FVector& Impulse, const FVector& Location, FName BoneName)
+{
+	const int32* Found = HitComponent && HitComponent->GetOwner() ? IndexByActor.Find(FObjectKey(HitComponent->GetOwner())) : nullptr;
+	if (!Found)
+	{
+		return false;
+	}
+
+	FStoredImpulse Stored;
+	Stored.Primitive = HitComponent;
+	Stored.BoneName = BoneName;
+	Stored.Impulse = Impulse;
+	Stored.Location = Location;
+	Stored.bAtLocation = true;
+	StoreImpulse(*Found, Stored);
+	return true;
+}
+
+void UStasisSubsystem::StoreImpulse(int32 Index, const FStoredImpulse& Impulse)
+{
+	TArray<FStoredImpulse, TInlineAllocator<2>>& Impulses = StoredImpulses[Index];
+	if (Impulses.Num() < StasisSystem::MaxStoredImpulses)
+	{
+		Impulses.Add(Impulse);
+		return;
+	}
+
+	// 超出上限：合并到同一物理体的记录，作用点按冲量大小加权
+	for (FStoredImpulse& Existing : Impulses)
+	{
+		if (Existing.Primitive == Impulse.Primitive && Existing.BoneName == Impulse.BoneName && Existing.bAtLocation == Impulse.bAtLocation)
+		{
+			const float ExistingWeight = Existing.Impulse.Size();
+			const float NewWeight = Impulse.Impulse.Size();
+			if (ExistingWeight + NewWeight > KINDA_SMALL_NUMBER)
+			{
+				Existing.Location = (Existing.Location * ExistingWeight + Impulse.Location * NewWeight) / (ExistingWeight + NewWeight);
+			}
+			Existing.Impulse += Impulse.Impulse;
+			return;
+		}
+	}
+
+	// 没有可合并的记录时并入最后一条（只保留冲量总量）
+	Impulses.Last().Impulse += Impulse.Impulse;
+}
+
+void UStasisSubsystem::PruneStaleEntries()
+{
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Entries[Index].Actor.IsValid())
+		{
+			ReleaseAt(Index, false);
+		}
+	}
+}
+
+// ==================== 延迟销毁 ====================
+
+void UStasisSubsystem::ScheduleDestroy(AActor* Actor, float Delay)
+{
+	if (!IsValid(Actor) || !GetWorld())
+	{
+		return;
+	}
+
+	const FObjectKey Key(Actor);
+	PendingDestroys.Add(Key, TimerWheel.Schedule(GetWorld()->GetTimeSeconds() + Delay, Key, static_cast<uint8>(ETimerTag::Destroy)));
+}
+
+void UStasisSubsystem::CancelScheduledDestroy(const AActor* Actor)
+{
+	if (Actor)
+	{
+		PendingDestroys.Remove(FObjectKey(Actor));
+	}
+}
+
+// ==================== 到期处理 ====================
+
+void UStasisSubsystem::ProcessExpired()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	ExpiredTimers.Reset();
+	TimerWheel.Advance(World->GetTimeSeconds(), ExpiredTimers);
+
+	for (const FTimerWheelEntry& Timer : ExpiredTimers)
+	{
+		if (Timer.Tag == static_cast<uint8>(ETimerTag::Destroy))
+		{
+			const uint32* PendingId = PendingDestroys.Find(Timer.Key);
+			if (!PendingId || *PendingId != Timer.Id)
+			{
+				continue;
+			}
+			PendingDestroys.Remove(Timer.Key);
+
+			if (AActor* Actor = Cast<AActor>(Timer.Key.ResolveObjectPtr()))
+			{
+				Actor->Destroy();
+			}
+			continue;
+		}
+
+		const int32* Found = IndexByActor.Find(Timer.Key);
+		if (!Found || Entries[*Found].TimerId != Timer.Id)
+		{
+			continue;
+		}
+
+		AActor* Actor = Entries[*Found].Actor.Get();
+		if (Actor && Actor->Implements<UStasisable>())
+		{
+			// 交给实现方退出定身（通常会调用 Release）
+			IStasisable::Execute_ExitStasis(Actor);
+		}
+
+		// 实现方没有解除（或 Actor 已失效）时兜底
+		if (const int32* StillFrozen = IndexByActor.Find(Timer.Key))
+		{
+			ReleaseAt(*StillFrozen, true);
+		}
+	}
+}
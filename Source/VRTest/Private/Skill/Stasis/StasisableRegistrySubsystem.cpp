@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Skill/Stasis/StasisableRegistrySubsystem.h"
+#include "Skill/Stasis/IStasisable.h"
+#include "Game/ShapeQuery.h"
+#include "Game/VRTestStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+UStasisableRegistrySubsystem* UStasisableRegistrySubsystem::Get(const UObject* WorldContextObject)
+{
+	if (!WorldContextObject || !GEngine)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull);
+	return World ? World->GetSubsystem<UStasisableRegistrySubsystem>() : nullptr;
+}
+
+void UStasisableRegistrySubsystem::RegisterStasisable(AActor* Actor)
+{
+	if (UStasisableRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->Register(Actor);
+	}
+}
+
+void UStasisableRegistrySubsystem::UnregisterStasisable(AActor* Actor)
+{
+	if (UStasisableRegistrySubsystem* Registry = Get(Actor))
+	{
+		Registry->Unregister(Actor);
+	}
+}
+
+bool UStasisableRegistrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UStasisableRegistrySubsystem::Deinitialize()
+{
+	Index.Reset();
+
+	Super::Deinitialize();
+}
+
+// ==================== 注册 ====================
+
+void UStasisableRegistrySubsystem::Register(AActor* Actor)
+{
+	if (!IsValid(Actor) || !Actor->Implements<UStasisable>())
+	{
+		return;
+	}
+
+	// 根组件不是 Primitive 时退回 Actor 位置
+	const UPrimitiveComponent* BoundsComponent = Cast<UPrimitiveComponent>(Actor->GetRootComponent());
+	Index.Add(Actor, BoundsComponent);
+}
+
+void UStasisableRegistrySubsystem::Unregister(AActor* Actor)
+{
+	Index.Remove(Actor);
+}
+
+// ==================== 查询 ====================
+
+AActor* UStasisableRegistrySubsystem::FindBestTarget(const FVector& Origin, const FVector& Direction, float Radius, float MaxAngleDegrees,
+	const TArray<AActor*>& IgnoreActors)
+{
+	const FShapeQuery Cone = FShapeQuery::MakeCone(Origin, Direction, Radius, MaxAngleDegrees);
+	if (!Cone.IsValid())
+	{
+		return nullptr;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_VRTest_StasisTargetQuery);
+
+	RefreshIndex();
+
+	// 宽相位 + 锥形判定只读紧凑数组，不访问 Actor；得分为夹角余弦
+	TArray<FShapeQueryHit, TInlineAllocator<32>> Candidates;
+	Cone.Collect(Index, Candidates);
+
+	if (Candidates.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// 部分选择：建堆 O(n)，之后每次只弹出当前最对准的一个，通常第一个就满足条件
+	auto MoreAligned = [](const FShapeQueryHit& A, const FShapeQueryHit& B) { return A.Score > B.Score; };
+	Candidates.Heapify(MoreAligned);
+
+	while (Candidates.Num() > 0)
+	{
+		FShapeQueryHit Best;
+		Candidates.HeapPop(Best, MoreAligned, EAllowShrinking::No);
+
+		AActor* Actor = Index.GetActor(Best.EntryIndex);
+		if (!Actor || Actor->IsHidden() || !Actor->GetActorEnableCollision() || IgnoreActors.Contains(Actor))
+		{
+			continue;
+		}
+
+		if (IStasisable::Execute_CanEnterStasis(Actor))
+		{
+			return Actor;
+		}
+	}
+
+	return nullptr;
+}
+
+const FActorSpatialIndex& UStasisableRegistrySubsystem::GetSpatialIndex()
+{
+	RefreshIndex();
+	return Index;
+}
+
+void UStasisableRegistrySubsystem::RefreshIndex()
+{
+	if (LastRefreshFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	LastRefreshFrame = GFrameCounter;
+	Index.Refresh();
+}
@@ -6,8 +6,8 @@
 
 AVRStasisFireMonitor::AVRStasisFireMonitor()
 {
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.TickGroup = TG_PrePhysics;
+	// 由手部运动采样驱动，不需要 Tick
+	PrimaryActorTick.bCanEverTick = false;
 }
 
 void AVRStasisFireMonitor::BeginPlay()
@@ -15,11 +15,31 @@ void AVRStasisFireMonitor::BeginPlay()
 	Super::BeginPlay();
 }
 
-void AVRStasisFireMonitor::Tick(float DeltaTime)
+void AVRStasisFireMonitor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::Tick(DeltaTime);
+	StopMonitoring();
 
-	if (!MonitoredHand || !StasisPoint)
+	Super::EndPlay(EndPlayReason);
+}
+
+void AVRStasisFireMonitor::Initialize(UPlayerGrabHand* InHand, AStasisPoint* InStasisPoint)
+{
+	StopMonitoring();
+
+	MonitoredHand = InHand;
+	StasisPoint = InStasisPoint;
+
+	if (MonitoredHand)
+	{
+		const UWorld* World = GetWorld();
+		MonitorStartTime = World ? World->GetTimeSeconds() : 0.0;
+		MotionSampledHandle = MonitoredHand->OnHandMotionSampled.AddUObject(this, &AVRStasisFireMonitor::HandleHandMotionSampled);
+	}
+}
+
+void AVRStasisFireMonitor::HandleHandMotionSampled(UPlayerGrabHand* Hand)
+{
+	if (!MonitoredHand || !IsValid(StasisPoint))
 	{
 		// 手部或定身球无效，销毁自身
 		Destroy();
@@ -34,76 +54,42 @@ void AVRStasisFireMonitor::Tick(float DeltaTime)
 		return;
 	}
 
-	// 更新手部速度
-	UpdateHandVelocity(DeltaTime);
-
-	// 检测速度是否超过阈值
-	if (!bSpeedOverThreshold && CurrentSpeed > SpeedThreshold)
-	{
-		bSpeedOverThreshold = true;
-	}
-
-	// 如果速度已超过阈值，且现在开始下降，触发发射
-	if (bSpeedOverThreshold && CurrentSpeed < LastSpeed)
+	// 速度超过阈值后开始下降：以峰值速度发射
+	FHandMotionSample Peak;
+	if (MonitoredHand->GetMotionHistory().FindSpeedPeak(MonitorStartTime, SpeedThreshold, PeakSpeedDropRatio, Peak))
 	{
-		FireStasisPoint();
+		FireStasisPoint(Peak.Velocity);
 	}
 }
 
-void AVRStasisFireMonitor::Initialize(UPlayerGrabHand* InHand, AStasisPoint* InStasisPoint)
+void AVRStasisFireMonitor::StopMonitoring()
 {
-	MonitoredHand = InHand;
-	StasisPoint = InStasisPoint;
-
-	if (MonitoredHand)
+	if (MonitoredHand && MotionSampledHandle.IsValid())
 	{
-		LastHandLocation = MonitoredHand->GetComponentLocation();
-		CurrentVelocity = FVector::ZeroVector;
-		LastVelocity = FVector::ZeroVector;
-		CurrentSpeed = 0.0f;
-		LastSpeed = 0.0f;
-		bSpeedOverThreshold = false;
+		MonitoredHand->OnHandMotionSampled.Remove(MotionSampledHandle);
 	}
+	MotionSampledHandle.Reset();
 }
 
-void AVRStasisFireMonitor::UpdateHandVelocity(float DeltaTime)
-{
-	if (!MonitoredHand || DeltaTime <= 0.0f)
-	{
-		return;
-	}
-
-	FVector CurrentLocation = MonitoredHand->GetComponentLocation();
-	
-	// 保存上一帧的速度
-	LastVelocity = CurrentVelocity;
-	LastSpeed = CurrentSpeed;
-
-	// 计算当前速度
-	CurrentVelocity = (CurrentLocation - LastHandLocation) / DeltaTime;
-	CurrentSpeed = CurrentVelocity.Size();
-
-	// 更新位置
-	LastHandLocation = CurrentLocation;
-}
-
-void AVRStasisFireMonitor::FireStasisPoint()
+void AVRStasisFireMonitor::FireStasisPoint(const FVector& PeakVelocity)
 {
 	if (!MonitoredHand || !StasisPoint)
 	{
 		return;
 	}
 
-	// 1) 计算发射上下文（VR：基于手部 LastVelocity 方向）
+	StopMonitoring();
+
+	// 1) 计算发射上下文（VR：基于手部峰值速度方向）
 	const FVector HandLocation = MonitoredHand->GetComponentLocation();
-	const FVector VelocityDirection = LastVelocity.GetSafeNormal();
+	const FVector VelocityDirection = PeakVelocity.GetSafeNormal();
 
 	TArray<AActor*> IgnoreActors;
 	IgnoreActors.Add(MonitoredHand->GetOwner()); // 忽略玩家自身
 	IgnoreActors.Add(StasisPoint); // 忽略定身球自身
 
 	// 2) 计算发射速度
-	const FVector InitVelocity = LastVelocity * FireSpeedFactor;
+	const FVector InitVelocity = PeakVelocity * FireSpeedFactor;
 
 	// 3) 释放定身球
 	MonitoredHand->ReleaseObject();
@@ -4,6 +4,89 @@
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 #include "Game/CollisionConfig.h"
+#include "Game/ShapeQuery.h"
+#include "Grabber/GrabbableRegistrySubsystem.h"
+#include "Skill/Stasis/StasisableRegistrySubsystem.h"
+
+namespace GameUtilsShapeQuery
+{
+	/** 取注册表的空间索引（非游戏世界返回 nullptr） */
+	const FActorSpatialIndex* GetIndex(const UObject* WorldContextObject, ERegisteredActorSet ActorSet)
+	{
+		switch (ActorSet)
+		{
+		case ERegisteredActorSet::Stasisable:
+			if (UStasisableRegistrySubsystem* Registry = UStasisableRegistrySubsystem::Get(WorldContextObject))
+			{
+				return &Registry->GetSpatialIndex();
+			}
+			break;
+		case ERegisteredActorSet::Grabbable:
+			if (UGrabbableRegistrySubsystem* Registry = UGrabbableRegistrySubsystem::Get(WorldContextObject))
+			{
+				return &Registry->GetSpatialIndex();
+			}
+			break;
+		}
+		return nullptr;
+	}
+
+	/** 执行查询并取前 MaxResults 个；IgnoreActors 在选择前剔除 */
+	const FActorSpatialIndex* Run(const UObject* WorldContextObject, ERegisteredActorSet ActorSet, const FShapeQuery& Query,
+		int32 MaxResults, const TArray<AActor*>& IgnoreActors, TArray<FShapeQueryHit, TInlineAllocator<64>>& OutHits)
+	{
+		const FActorSpatialIndex* Index = GetIndex(WorldContextObject, ActorSet);
+		if (!Index || !Query.IsValid())
+		{
+			return nullptr;
+		}
+
+		Query.Collect(*Index, OutHits);
+
+		// 与注册表自身的查询一致：隐藏或关闭碰撞的 Actor（对象池中的箭等）仍在注册表里，这里排除
+		OutHits.RemoveAllSwap([Index, &IgnoreActors](const FShapeQueryHit& Hit)
+		{
+			const AActor* Actor = Index->GetActor(Hit.EntryIndex);
+			return !Actor || Actor->IsHidden() || !Actor->GetActorEnableCollision() || IgnoreActors.Contains(Actor);
+		}, EAllowShrinking::No);
+
+		FShapeQuery::SelectTop(OutHits, MaxResults);
+		return Index;
+	}
+
+	/** 锥形/扇形：得分为夹角余弦，只对最终结果做 Acos */
+	TArray<FActorWithAngle> RunAngular(const UObject* WorldContextObject, ERegisteredActorSet ActorSet, const FShapeQuery& Query,
+		int32 MaxResults, const TArray<AActor*>& IgnoreActors)
+	{
+		TArray<FActorWithAngle> Results;
+		TArray<FShapeQueryHit, TInlineAllocator<64>> Hits;
+		if (const FActorSpatialIndex* Index = Run(WorldContextObject, ActorSet, Query, MaxResults, IgnoreActors, Hits))
+		{
+			Results.Reserve(Hits.Num());
+			for (const FShapeQueryHit& Hit : Hits)
+			{
+				Results.Add(FActorWithAngle(Index->GetActor(Hit.EntryIndex), FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(Hit.Score, -1.0f, 1.0f)))));
+			}
+		}
+		return Results;
+	}
+
+	TArray<AActor*> RunActors(const UObject* WorldContextObject, ERegisteredActorSet ActorSet, const FShapeQuery& Query,
+		int32 MaxResults, const TArray<AActor*>& IgnoreActors)
+	{
+		TArray<AActor*> Results;
+		TArray<FShapeQueryHit, TInlineAllocator<64>> Hits;
+		if (const FActorSpatialIndex* Index = Run(WorldContextObject, ActorSet, Query, MaxResults, IgnoreActors, Hits))
+		{
+			Results.Reserve(Hits.Num());
+			for (const FShapeQueryHit& Hit : Hits)
+			{
+				Results.Add(Index->GetActor(Hit.EntryIndex));
+			}
+		}
+		return Results;
+	}
+}
 
 TArray<FActorWithAngle> UGameUtils::FindActorsInCone(
 	UObject* WorldContextObject,
@@ -79,4 +162,64 @@ TArray<FActorWithAngle> UGameUtils::FindActorsInCone(
 	});
 
 	return Results;
-}
\ No newline at end of file
+}
+
+// ==================== 注册表形状查询 ====================
+
+TArray<FActorWithAngle> UGameUtils::QueryRegisteredActorsInCone(
+	UObject* WorldContextObject,
+	ERegisteredActorSet ActorSet,
+	const FVector& Origin,
+	const FVector& Direction,
+	float Range,
+	float MaxAngleDegrees,
+	int32 MaxResults,
+	const TArray<AActor*>& IgnoreActors)
+{
+	return GameUtilsShapeQuery::RunAngular(WorldContextObject, ActorSet,
+		FShapeQuery::MakeCone(Origin, Direction, Range, MaxAngleDegrees), MaxResults, IgnoreActors);
+}
+
+TArray<FActorWithAngle> UGameUtils::QueryRegisteredActorsInSector(
+	UObject* WorldContextObject,
+	ERegisteredActorSet ActorSet,
+	const FVector& Origin,
+	const FVector& Direction,
+	float Range,
+	float MaxAngleDegrees,
+	float HalfHeight,
+	int32 MaxResults,
+	const TArray<AActor*>& IgnoreActors)
+{
+	return GameUtilsShapeQuery::RunAngular(WorldContextObject, ActorSet,
+		FShapeQuery::MakeSector(Origin, Direction, Range, MaxAngleDegrees, HalfHeight), MaxResults, IgnoreActors);
+}
+
+TArray<AActor*> UGameUtils::QueryRegisteredActorsInCapsule(
+	UObject* WorldContextObject,
+	ERegisteredActorSet ActorSet,
+	const FVector& Start,
+	const FVector& End,
+	float Radius,
+	int32 MaxResults,
+	const TArray<AActor*>& IgnoreActors)
+{
+	return GameUtilsShapeQuery::RunActors(WorldContextObject, ActorSet,
+		FShapeQuery::MakeCapsule(Start, End, Radius), MaxResults, IgnoreActors);
+}
+
+TArray<AActor*> UGameUtils::QueryRegisteredActorsInFrustum(
+	UObject* WorldContextObject,
+	ERegisteredActorSet ActorSet,
+	const FVector& Origin,
+	const FRotator& Rotation,
+	float FOVDegrees,
+	float AspectRatio,
+	float NearDistance,
+	float FarDistance,
+	int32 MaxResults,
+	const TArray<AActor*>& IgnoreActors)
+{
+	return GameUtilsShapeQuery::RunActors(WorldContextObject, ActorSet,
+		FShapeQuery::MakeFrustum(Origin, Rotation, FOVDegrees * 0.5f, AspectRatio, NearDistance, FarDistance), MaxResults, IgnoreActors);
+}
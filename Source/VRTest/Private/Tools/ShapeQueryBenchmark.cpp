@@ -0,0 +1,194 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Game/GameUtils.h"
+#include "Game/ShapeQuery.h"
+#include "Game/ActorSpatialIndex.h"
+#include "Components/SphereComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+/**
+ * 形状查询基准测试
+ *
+ * 控制台：VRTest.ShapeQuery.Bench [数量...] [-q=查询次数]
+ * 例：VRTest.ShapeQuery.Bench 1000 10000 50000
+ *
+ * 每个数量：在世界原点附近生成带球形碰撞的临时 Actor（密度固定），建立 FActorSpatialIndex，
+ * 用同一组随机锥形分别跑：
+ * - Overlap：UGameUtils::FindActorsInCone（物理 Overlap + Acos + 全排序）
+ * - Scalar：空间索引 + FShapeQuery::TestSphere 逐个判定 + 全排序
+ * - Batch：空间索引 + FShapeQuery::Collect（4 个一组）+ 全排序
+ * - TopK：同 Batch，只取前 8 个
+ * 输出每次查询的平均耗时与结果总数；Scalar 与 Batch 的结果数应一致（Overlap 按碰撞体判定，可能略有差异）
+ */
+namespace ShapeQueryBenchmark
+{
+	constexpr float Spacing = 200.0f;
+	constexpr float ActorRadius = 30.0f;
+	constexpr float ConeRange = 1500.0f;
+	constexpr float ConeHalfAngle = 30.0f;
+	constexpr int32 TopK = 8;
+
+	struct FCone
+	{
+		FVector Origin;
+		FVector Direction;
+	};
+
+	FVector RandomPointInCube(FRandomStream& Random, float HalfExtent)
+	{
+		return FVector(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent));
+	}
+
+	void RunOnce(UWorld* World, int32 Count, int32 NumQueries)
+	{
+		// 密度固定：立方体边长随数量增长
+		const float HalfExtent = Spacing * FMath::Pow(static_cast<float>(Count), 1.0f / 3.0f) * 0.5f;
+		FRandomStream Random(Count);
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		SpawnParams.ObjectFlags |= RF_Transient;
+
+		TArray<AActor*> Actors;
+		Actors.Reserve(Count);
+		FActorSpatialIndex Index;
+
+		for (int32 ActorIndex = 0; ActorIndex < Count; ++ActorIndex)
+		{
+			const FVector Location = RandomPointInCube(Random, HalfExtent);
+			AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location), SpawnParams);
+			if (!Actor)
+			{
+				continue;
+			}
+
+			USphereComponent* Sphere = NewObject<USphereComponent>(Actor);
+			Sphere->SetSphereRadius(ActorRadius);
+			Sphere->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+			Sphere->SetCollisionObjectType(ECC_WorldDynamic);
+			Sphere->SetCollisionResponseToAllChannels(ECR_Overlap);
+			Sphere->SetGenerateOverlapEvents(false);
+			Actor->SetRootComponent(Sphere);
+			Sphere->SetWorldLocation(Location);
+			Sphere->RegisterComponent();
+
+			Actors.Add(Actor);
+			Index.Add(Actor, Sphere);
+		}
+
+		TArray<FCone> Cones;
+		Cones.Reserve(NumQueries);
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; ++QueryIndex)
+		{
+			Cones.Add({ RandomPointInCube(Random, HalfExtent), Random.GetUnitVector() });
+		}
+
+		const TArray<TEnumAsByte<EObjectTypeQuery>> ObjectTypes = { UEngineTypes::ConvertToObjectType(ECC_WorldDynamic) };
+		const TArray<AActor*> NoIgnore;
+
+		// Overlap
+		int64 OverlapResults = 0;
+		double StartTime = FPlatformTime::Seconds();
+		for (const FCone& Cone : Cones)
+		{
+			OverlapResults += UGameUtils::FindActorsInCone(World, Cone.Origin, Cone.Direction, ConeRange, ConeHalfAngle, ObjectTypes, NoIgnore).Num();
+		}
+		const double OverlapMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumQueries;
+
+		// Scalar
+		int64 ScalarResults = 0;
+		TArray<FShapeQueryHit> Hits;
+		StartTime = FPlatformTime::Seconds();
+		for (const FCone& Cone : Cones)
+		{
+			const FShapeQuery Query = FShapeQuery::MakeCone(Cone.Origin, Cone.Direction, ConeRange, ConeHalfAngle);
+			Hits.Reset();
+			Index.ForEachInSphere(Query.GetBoundsCenter(), Query.GetBoundsRadius(), [&](int32 EntryIndex)
+			{
+				float Score;
+				if (Query.TestSphere(Index.GetPositions()[EntryIndex], Index.GetRadii()[EntryIndex], Score))
+				{
+					Hits.Add({ EntryIndex, Score });
+				}
+			});
+			FShapeQuery::SelectTop(Hits, 0);
+			ScalarResults += Hits.Num();
+		}
+		const double ScalarMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumQueries;
+
+		// Batch
+		int64 BatchResults = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (const FCone& Cone : Cones)
+		{
+			Hits.Reset();
+			FShapeQuery::MakeCone(Cone.Origin, Cone.Direction, ConeRange, ConeHalfAngle).Collect(Index, Hits);
+			FShapeQuery::SelectTop(Hits, 0);
+			BatchResults += Hits.Num();
+		}
+		const double BatchMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumQueries;
+
+		// TopK
+		int64 TopKResults = 0;
+		StartTime = FPlatformTime::Seconds();
+		for (const FCone& Cone : Cones)
+		{
+			Hits.Reset();
+			FShapeQuery::MakeCone(Cone.Origin, Cone.Direction, ConeRange, ConeHalfAngle).Collect(Index, Hits);
+			FShapeQuery::SelectTop(Hits, TopK);
+			TopKResults += Hits.Num();
+		}
+		const double TopKMs = (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumQueries;
+
+		UE_LOG(LogTemp, Log, TEXT("ShapeQuery Bench: %d actors, %d queries | Overlap %.4f ms (%lld) | Scalar %.4f ms (%lld) | Batch %.4f ms (%lld) | Top%d %.4f ms (%lld)"),
+			Actors.Num(), NumQueries, OverlapMs, OverlapResults, ScalarMs, ScalarResults, BatchMs, BatchResults, TopK, TopKMs, TopKResults);
+
+		if (ScalarResults != BatchResults)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("ShapeQuery Bench: scalar/batch result mismatch (%lld vs %lld)"), ScalarResults, BatchResults);
+		}
+
+		for (AActor* Actor : Actors)
+		{
+			Actor->Destroy();
+		}
+	}
+
+	FAutoConsoleCommandWithWorldAndArgs BenchCommand(
+		TEXT("VRTest.ShapeQuery.Bench"),
+		TEXT("对比物理 Overlap 锥形查询与注册表批量形状查询。用法：VRTest.ShapeQuery.Bench [数量...] [-q=查询次数]，默认 1000 10000 50000"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World)
+			{
+				return;
+			}
+
+			TArray<int32> Counts;
+			int32 NumQueries = 200;
+			for (const FString& Arg : Args)
+			{
+				if (Arg.StartsWith(TEXT("-q=")))
+				{
+					NumQueries = FMath::Max(1, FCString::Atoi(*Arg.RightChop(3)));
+				}
+				else if (const int32 Count = FCString::Atoi(*Arg); Count > 0)
+				{
+					Counts.Add(Count);
+				}
+			}
+
+			if (Counts.Num() == 0)
+			{
+				Counts = { 1000, 10000, 50000 };
+			}
+
+			for (const int32 Count : Counts)
+			{
+				RunOnce(World, Count, NumQueries);
+			}
+		}));
+}
@@ -8,6 +8,9 @@
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnDead);
 
+/** HP 变化：批量结算期间（BeginHPBatch/EndHPBatch）只在结束时广播一次净变化 */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnHPChanged, float, NewHP, float, Delta);
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class VRTEST_API UAliveComponent : public UActorComponent
 {
@@ -28,10 +31,22 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Health")
 	FOnDead OnDead;
 
+	UPROPERTY(BlueprintAssignable, Category = "Health")
+	FOnHPChanged OnHPChanged;
+
 private:
 	UPROPERTY(VisibleAnywhere, Category = "Health")
 	float HP;
 
+	/** 批量结算嵌套深度；> 0 时 OnHPChanged 推迟到 EndHPBatch */
+	int32 HPBatchDepth = 0;
+
+	/** 批量结算开始时的 HP */
+	float HPBeforeBatch = 0.0f;
+
+	/** HP 从 OldHP 变化后广播（批量结算期间不广播） */
+	void NotifyHPChanged(float OldHP);
+
 public:
 	UFUNCTION(BlueprintCallable, Category = "Health")
 	void DecreaseHP(float DecreaseAmount);
@@ -44,4 +59,10 @@ public:
 
 	UFUNCTION(BlueprintPure, Category = "Health")
 	float GetHP() const { return HP; }
+
+	/** 开始批量结算：之间的多次 HP 变化合并为一次 OnHPChanged（OnDead 仍立即广播） */
+	void BeginHPBatch();
+
+	/** 结束批量结算：HP 有变化时广播一次 */
+	void EndHPBatch();
 };
@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Effect/EffectTypes.h"
+#include "EffectQueueSubsystem.generated.h"
+
+class ABaseCharacter;
+
+/**
+ * 效果队列（World 级子系统）
+ *
+ * - 命中点（箭、火）通过 ApplyEffect 提交：目标是 ABaseCharacter 时只入队，其他 IEffectable（箭、可破坏物等需要当帧响应）仍同步调用
+ * - 入队时按（目标, 类型掩码）合并成紧凑记录：同一帧多支箭命中同一角色 -> 伤害相加，只调用一次 ApplyEffect
+ * - 每帧结算一次：同一目标的所有记录在 UAliveComponent 的批量结算中执行，HP 只广播一次 OnHPChanged
+ * - GameSettings.bQueueCharacterEffects 关闭时退回命中即结算
+ */
+UCLASS()
+class VRTEST_API UEffectQueueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的效果队列，非游戏世界返回 nullptr */
+	static UEffectQueueSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 命中点的统一入口：角色目标入队，其他目标（或队列不可用时）立即调用 IEffectable::ApplyEffect */
+	static void ApplyEffect(AActor* Target, const FEffect& Effect);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	/** 入队（目标须实现 IEffectable）；与已有的同目标、同类型记录合并 */
+	void Enqueue(AActor* Target, const FEffect& Effect);
+
+	/** 立即结算队列中的所有记录（结算过程中新提交的效果留到下一次） */
+	void Flush();
+
+	UFUNCTION(BlueprintPure, Category = "Effect")
+	int32 GetPendingCount() const { return Records.Num(); }
+
+protected:
+	/** 合并后的效果记录 */
+	struct FEffectRecord
+	{
+		TWeakObjectPtr<AActor> Target;
+		uint8 TypeMask = 0;
+
+		/** 合并：伤害相加、持续时间取最大、Causer/Instigator 取最后一次 */
+		float Amount = 0.0f;
+		float Duration = 0.0f;
+		TWeakObjectPtr<AActor> Causer;
+		TWeakObjectPtr<ABaseCharacter> Instigator;
+
+		/** 合并的命中次数 */
+		int32 HitCount = 0;
+	};
+
+	TArray<FEffectRecord> Records;
+
+	/** (目标, 类型掩码) -> Records 下标 */
+	TMap<TPair<FObjectKey, uint8>, int32> RecordIndex;
+
+	/** 结算用的缓冲（跨帧复用） */
+	TArray<FEffectRecord> ResolvingRecords;
+
+	/** 结算中（ApplyEffect 回调里再次 Flush 时直接返回） */
+	bool bFlushing = false;
+};
@@ -17,6 +17,35 @@ enum class EEffectType : uint8
 	Stasis UMETA(DisplayName = "Stasis")
 };
 
+/** 效果类型位掩码：第 i 位对应 EEffectType i */
+FORCEINLINE uint8 EffectTypeToMask(EEffectType Type)
+{
+	return static_cast<uint8>(1u << static_cast<uint8>(Type));
+}
+
+FORCEINLINE uint8 MakeEffectTypeMask(TConstArrayView<EEffectType> Types)
+{
+	uint8 Mask = 0;
+	for (const EEffectType Type : Types)
+	{
+		Mask |= EffectTypeToMask(Type);
+	}
+	return Mask;
+}
+
+/** 按枚举顺序展开位掩码 */
+FORCEINLINE void EffectTypeMaskToArray(uint8 Mask, TArray<EEffectType>& OutTypes)
+{
+	OutTypes.Reset();
+	for (uint8 Bit = 0; Mask != 0; ++Bit, Mask >>= 1)
+	{
+		if (Mask & 1u)
+		{
+			OutTypes.Add(static_cast<EEffectType>(Bit));
+		}
+	}
+}
+
 USTRUCT(BlueprintType)
 struct FEffect
 {
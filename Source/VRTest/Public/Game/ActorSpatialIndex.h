@@ -0,0 +1,143 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class UPrimitiveComponent;
+
+/**
+ * Actor 空间索引（松散网格 + 紧凑数组）
+ *
+ * - 每个条目的位置/包围半径存放在连续数组中，查询只读这些数组，不碰 Actor
+ * - 按中心点所在格子分桶；包围半径超过半个格子的大物体放在 Oversize 列表，每次查询都检查
+ * - Refresh() 每帧最多一次：从绑定的 Primitive 缓存的 Bounds（或 Actor 位置）刷新条目，并重新分桶
+ * - 查询范围覆盖的格子数多于条目数时，退化为线性扫描紧凑数组
+ *
+ * 纯数据结构，不依赖 World，可被各个注册表（可抓取物、可定身物等）复用。
+ */
+class VRTEST_API FActorSpatialIndex
+{
+public:
+	explicit FActorSpatialIndex(float InCellSize = 400.0f);
+
+	/**
+	 * 添加条目（已存在则只更新绑定的 Primitive）
+	 * @param BoundsComponent 位置/半径来源；为空时使用 Actor 位置与 FallbackRadius
+	 */
+	int32 Add(AActor* Actor, const UPrimitiveComponent* BoundsComponent, float FallbackRadius = 50.0f);
+
+	/** 移除条目（与末尾交换，下标会变化） */
+	bool Remove(const AActor* Actor);
+
+	/** 清空 */
+	void Reset();
+
+	/** 从 Actor/Primitive 刷新位置与半径并重新分桶；已失效的条目会被移除 */
+	void Refresh();
+
+	int32 Num() const { return Actors.Num(); }
+
+	// ==================== 紧凑数组（按下标读取） ====================
+
+	const TArray<FVector>& GetPositions() const { return Positions; }
+	const TArray<float>& GetRadii() const { return Radii; }
+	AActor* GetActor(int32 Index) const { return Actors[Index].Get(); }
+
+	// ==================== 查询 ====================
+
+	/**
+	 * 遍历包围球与查询球相交的条目（宽相位，调用方自行做精确判定）
+	 * @param Visitor void(int32 Index)
+	 */
+	template <typename FuncType>
+	void ForEachInSphere(const FVector& Center, float Radius, FuncType&& Visitor) const;
+
+private:
+	FIntVector GetCellCoord(const FVector& Location) const;
+	bool IsOversize(float Radius) const { return Radius > CellSize * 0.5f; }
+
+	/** 把条目放入格子/Oversize 列表 */
+	void Bin(int32 Index);
+
+	/** 把条目从所在格子/Oversize 列表取出 */
+	void Unbin(int32 Index);
+
+	/** 把桶中的 OldIndex 改写为 NewIndex（交换删除后使用） */
+	void Rebin(int32 OldIndex, int32 NewIndex);
+
+	void RemoveAt(int32 Index);
+
+	float CellSize;
+	float InvCellSize;
+
+	// 紧凑数组（下标一致）
+	TArray<FVector> Positions;
+	TArray<float> Radii;
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	TArray<FObjectKey> EntryKeys;
+	TArray<TWeakObjectPtr<const UPrimitiveComponent>> BoundsComponents;
+	TArray<FIntVector> EntryCells;
+	TArray<bool> EntryOversize;
+
+	/** Actor -> 下标 */
+	TMap<FObjectKey, int32> IndexByActor;
+
+	/** 格子 -> 条目下标 */
+	TMap<FIntVector, TArray<int32>> Cells;
+
+	/** 大物体（半径超过半个格子） */
+	TArray<int32> OversizeEntries;
+};
+
+template <typename FuncType>
+void FActorSpatialIndex::ForEachInSphere(const FVector& Center, float Radius, FuncType&& Visitor) const
+{
+	// 松散网格：格子内条目的半径不超过半个格子，查询范围外扩半个格子即可覆盖
+	const float ExpandedRadius = Radius + CellSize * 0.5f;
+	const FIntVector MinCell = GetCellCoord(Center - FVector(ExpandedRadius));
+	const FIntVector MaxCell = GetCellCoord(Center + FVector(ExpandedRadius));
+	const int64 CellCount = int64(MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1) * (MaxCell.Z - MinCell.Z + 1);
+
+	auto TestEntry = [&](int32 Index)
+	{
+		const float Reach = Radius + Radii[Index];
+		if (FVector::DistSquared(Positions[Index], Center) <= Reach * Reach)
+		{
+			Visitor(Index);
+		}
+	};
+
+	if (CellCount >= Positions.Num() - OversizeEntries.Num())
+	{
+		// 查询范围很大：直接扫紧凑数组更快
+		for (int32 Index = 0; Index < Positions.Num(); ++Index)
+		{
+			TestEntry(Index);
+		}
+		return;
+	}
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				if (const TArray<int32>* Bucket = Cells.Find(FIntVector(X, Y, Z)))
+				{
+					for (const int32 Index : *Bucket)
+					{
+						TestEntry(Index);
+					}
+				}
+			}
+		}
+	}
+
+	for (const int32 Index : OversizeEntries)
+	{
+		TestEntry(Index);
+	}
+}
@@ -20,7 +20,12 @@ class VRTEST_API ABaseEnemy : public ABaseCharacter, public IGrabbable, public I
 
 public:
 	ABaseEnemy();
-	// ==================== 状态 ====================
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:	// ==================== 状态 ====================
 	
 	/** 当前控制此物体的所有手（双手抓取用） */
 	UPROPERTY(BlueprintReadOnly, Category = "Grab|State")
@@ -35,8 +40,8 @@ public:
 	virtual bool SupportsDualHandGrab_Implementation() const override;
 	virtual void OnGrabbed_Implementation(UPlayerGrabHand* Hand) override;
 	virtual void OnReleased_Implementation(UPlayerGrabHand* Hand) override;
-	virtual void OnGrabSelected_Implementation() override;
-	virtual void OnGrabDeselected_Implementation() override;
+	virtual void OnGrabSelected_Implementation(UPlayerGrabHand* Hand) override;
+	virtual void OnGrabDeselected_Implementation(UPlayerGrabHand* Hand) override;
 	
 	// ==================== IStasisable 接口实现 ======================================
 	virtual void EnterStasis_Implementation(double TimeToStasis) override;
@@ -88,6 +88,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Grab")
 	AActor* TargetedObject = nullptr;
 
+	/** 选中 TargetedObject 时用于判断的手（取消选中时传同一只手） */
+	UPROPERTY()
+	UPCGrabHand* TargetedByHand = nullptr;
+
 	/** 当前瞄准的骨骼名（如果目标是骨骼网格体） */
 	UPROPERTY(BlueprintReadOnly, Category = "Grab")
 	FName TargetedBoneName;
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Game/Characters/BasePlayer.h"
+#include "Game/VRBodyZone.h"
 #include "BaseVRPlayer.generated.h"
 
 class UVRGrabHand;
@@ -44,7 +45,7 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR|Components")
 	UCameraComponent* VRCamera;
 
-	/** 背包碰撞区域 */
+	/** 背包区域（只提供形状，在蓝图设置变换和尺寸；不参与碰撞、不产生重叠事件） */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "VR|Components")
 	UBoxComponent* BackpackCollision;
 
@@ -89,6 +90,19 @@ public:
 	// ==================== 配置参数 ====================
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|Components")
 	FRotator VRHandRotationOffset = FRotator(0.f, 0.f, 0.f);
+
+	// ==================== 身体区域 ====================
+
+	/**
+	 * 背包以外的身体区域（箭袋、腰挂等），定义在身体坐标系（HMD 位置 + Yaw）中。
+	 * 背包区域仍由 BackpackCollision 的形状决定，且优先于这里的区域。
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|BodyZones")
+	TArray<FVRBodyZone> BodyZones;
+
+	/** 退出余量：手需离开区域超过此距离才算离开，避免在边界上反复进出触发震动 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|BodyZones", meta=(ClampMin="0.0"))
+	float BodyZoneExitMargin = 3.0f;
 	
 	// ==================== 输入处理 ====================
 	
@@ -120,16 +134,14 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Tools")
 	void SetVRHandRotationOffset(FRotator RotationOffset);
 
-	// Backpack overlap handling (Obj_PlayerHand)
-	UFUNCTION()
-	void OnBackpackBeginOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
-	UFUNCTION()
-	void OnBackpackEndOverlap(UPrimitiveComponent* OverlappedComponent, AActor* OtherActor,
-		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
+	/**
+	 * 每帧解析计算双手所在的身体区域（替代背包碰撞体的重叠事件）：
+	 * 每只手只做几次点积，不产生物理重叠查询
+	 */
+	void UpdateBodyZones();
 
-	UVRGrabHand* GetHandFromCollision(UPrimitiveComponent* Comp) const;
+	/** 查找手所在的区域（当前区域带退出余量，优先保持） */
+	EVRBodyZone FindBodyZone(const UVRGrabHand* Hand, const FTransform& BodyFrame, const FTransform& BackpackFrame) const;
 
 	/**
 	 * 每帧同步 Pawn 胶囊体与相机：
@@ -9,6 +9,7 @@
 
 class ABow;
 class AArrow;
+class UArrowImpactAsset;
 class USkillAsset;
 class UMaterialInterface;
 
@@ -39,6 +40,68 @@ public:
 	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow")
 	TSoftClassPtr<AArrow> ArrowClass;
 
+	/** 箭对象池：开局预生成的箭数量 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Pool", meta=(ClampMin="0"))
+	int32 ArrowPoolPrewarmCount = 8;
+
+	/** 箭对象池：场景中同时存在的箭上限（超过后回收 Stuck/Idle 的箭） */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Pool", meta=(ClampMin="1"))
+	int32 ArrowPoolMaxCount = 32;
+
+	/** 箭对象池：回收评分中每秒存在时间的权重 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Pool", meta=(ClampMin="0.0"))
+	float ArrowRecycleAgeWeight = 1.0f;
+
+	/** 箭对象池：回收评分中每米距离的权重（离请求点越远越优先回收） */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Pool", meta=(ClampMin="0.0"))
+	float ArrowRecycleDistanceWeight = 0.5f;
+
+	/** 插在静态场景上的箭是否转成实例化网格（Actor 回到对象池，实例只做表现，不可再拾取） */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Pool")
+	bool bInstanceStuckArrows = true;
+
+	/** 插在静态场景上多久后转成实例（秒，这段时间内仍可被拾取/重力手套选中） */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Pool", meta=(ClampMin="0.0", EditCondition="bInstanceStuckArrows"))
+	float StuckArrowInstanceDelay = 5.0f;
+
+	/** 每种箭网格最多保留的实例数，超出后覆盖最早的实例（FIFO） */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Pool", meta=(ClampMin="1", EditCondition="bInstanceStuckArrows"))
+	int32 StuckArrowInstanceBudget = 128;
+
+	/** 箭的命中模型（物理材质 -> 插入/弹飞参数，骨骼 -> 伤害倍率）；未配置时所有命中都直接插入 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Bow|Impact")
+	TSoftObjectPtr<UArrowImpactAsset> ArrowImpactAsset;
+
+	// ==================== 放置（PC 丢弃/批量摆放） ====================
+
+	/** 地面高度缓存的格子尺寸（cm） */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Grab|Drop", meta=(ClampMin="5.0"))
+	float DropGroundCellSize = 25.0f;
+
+	/** 地面高度缓存的有效期（秒），过期的格子下次查询时重新采样 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Grab|Drop", meta=(ClampMin="0.0"))
+	float DropGroundCacheLifetime = 10.0f;
+
+	/** 地面高度优先从 NavMesh 投影获取（不做物理查询），无 NavMesh 时退回向下射线 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Grab|Drop")
+	bool bDropUseNavMesh = false;
+
+	/** 期望位置被占用时，向外搜索的圈数（每圈 8 个候选点） */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Grab|Drop", meta=(ClampMin="0", ClampMax="4"))
+	int32 DropSearchRings = 2;
+
+	// ==================== 定身 ====================
+
+	/** 解除定身时释放（原速度 + 累计冲量）后的最大速度（cm/s），<= 0 表示不限制 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Skill|Stasis", meta=(ClampMin="0.0"))
+	float StasisMaxReleaseSpeed = 3000.0f;
+
+	// ==================== 效果 ====================
+
+	/** 角色受到的效果（箭、火等）先入队，每帧按目标合并后统一结算；关闭时命中即同步结算 */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadOnly, Category = "Effect")
+	bool bQueueCharacterEffects = true;
+
 	// ==================== StarDraw 相关 ====================
 
 	/** 技能总资产：包含 StarDraw 的轨迹映射 + FingerPoint/MainStar/OtherStar 蓝图类 */
@@ -75,6 +138,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Game Settings")
 	TSubclassOf<AArrow> GetArrowClass() const;
 
+	/** 获取箭的命中模型（同步加载）。未配置则返回 nullptr（不报警告，命中按旧逻辑直接插入）。 */
+	UFUNCTION(BlueprintCallable, Category = "Game Settings")
+	UArrowImpactAsset* GetArrowImpactAsset() const;
+
 	UFUNCTION(BlueprintCallable, Category = "Game Settings")
 	UAudioNormalSoundAsset* GetNormalSoundAsset() const;
 
@@ -26,6 +26,18 @@ struct FActorWithAngle
 	FActorWithAngle(AActor* InActor, float InAngle) : Actor(InActor), Angle(InAngle) {}
 };
 
+/**
+ * 形状查询使用的注册表（Actor 集合）
+ */
+UENUM(BlueprintType)
+enum class ERegisteredActorSet : uint8
+{
+	/** 可定身物（UStasisableRegistrySubsystem） */
+	Stasisable,
+	/** 可抓取物（UGrabbableRegistrySubsystem） */
+	Grabbable,
+};
+
 /**
  * 游戏通用工具函数库
  */
@@ -56,5 +68,77 @@ public:
 		const TArray<TEnumAsByte<EObjectTypeQuery>>& ObjectTypes,
 		const TArray<AActor*>& IgnoreActors
 	);
+
+	// ==================== 注册表形状查询 ====================
+	// 在注册表的紧凑数组上批量判定（FShapeQuery），不走物理 Overlap；按条目包围球判定
+	// MaxResults <= 0 时返回全部结果
+
+	/**
+	 * 锥形查询
+	 * @return 按夹角从小到大排序
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Game|Utils|ShapeQuery", meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "IgnoreActors"))
+	static TArray<FActorWithAngle> QueryRegisteredActorsInCone(
+		UObject* WorldContextObject,
+		ERegisteredActorSet ActorSet,
+		const FVector& Origin,
+		const FVector& Direction,
+		float Range,
+		float MaxAngleDegrees,
+		int32 MaxResults,
+		const TArray<AActor*>& IgnoreActors
+	);
+
+	/**
+	 * 水平扇形查询（高度差不超过 HalfHeight）
+	 * @return 按水平夹角从小到大排序
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Game|Utils|ShapeQuery", meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "IgnoreActors"))
+	static TArray<FActorWithAngle> QueryRegisteredActorsInSector(
+		UObject* WorldContextObject,
+		ERegisteredActorSet ActorSet,
+		const FVector& Origin,
+		const FVector& Direction,
+		float Range,
+		float MaxAngleDegrees,
+		float HalfHeight,
+		int32 MaxResults,
+		const TArray<AActor*>& IgnoreActors
+	);
+
+	/**
+	 * 胶囊体查询（Start 到 End 的线段 + 半径）
+	 * @return 按沿线段的距离从近到远排序
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Game|Utils|ShapeQuery", meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "IgnoreActors"))
+	static TArray<AActor*> QueryRegisteredActorsInCapsule(
+		UObject* WorldContextObject,
+		ERegisteredActorSet ActorSet,
+		const FVector& Start,
+		const FVector& End,
+		float Radius,
+		int32 MaxResults,
+		const TArray<AActor*>& IgnoreActors
+	);
+
+	/**
+	 * 视锥查询
+	 * @param FOVDegrees 水平视角（全角）
+	 * @param AspectRatio 宽/高
+	 * @return 按深度从近到远排序
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Game|Utils|ShapeQuery", meta = (WorldContext = "WorldContextObject", AutoCreateRefTerm = "IgnoreActors"))
+	static TArray<AActor*> QueryRegisteredActorsInFrustum(
+		UObject* WorldContextObject,
+		ERegisteredActorSet ActorSet,
+		const FVector& Origin,
+		const FRotator& Rotation,
+		float FOVDegrees,
+		float AspectRatio,
+		float NearDistance,
+		float FarDistance,
+		int32 MaxResults,
+		const TArray<AActor*>& IgnoreActors
+	);
 };
 
@@ -13,7 +13,7 @@ class AGrabbeeObject;
  * 
  * 设计原则：
  * - 背包只存储弓(1把)和箭(有上限)
- * - 物品是"虚拟存储"：放入时销毁Actor，取出时重新生成
+ * - 物品是"虚拟存储"：放入时把箭还给对象池，取出时从对象池复用（无对象池时销毁/生成）
  * - 提供纯数据接口，不处理VR/PC的具体交互逻辑
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -46,7 +46,7 @@ public:
 	/**
 	 * 尝试从背包取出箭
 	 * @param SpawnTransform 生成位置
-	 * @return 生成的箭Actor，如果背包里没有箭则返回nullptr
+	 * @return 取出的箭Actor（优先来自 UArrowPoolSubsystem），如果背包里没有箭则返回nullptr
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Arrow")
 	AGrabbeeObject* TryRetrieveArrow(const FTransform& SpawnTransform);
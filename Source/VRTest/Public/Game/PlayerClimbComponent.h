@@ -15,6 +15,9 @@ struct FPlayerClimbHandRecord
 {
 	GENERATED_BODY()
 
+	UPROPERTY()
+	TWeakObjectPtr<UPlayerGrabHand> Hand;
+
 	UPROPERTY()
 	FVector GrabPointWorld = FVector::ZeroVector;
 
@@ -33,6 +36,9 @@ class VRTEST_API UPlayerClimbComponent : public UActorComponent
 public:
 	UPlayerClimbComponent();
 
+	/** 同时抓握的最大数量（两只手） */
+	static constexpr int32 MaxClimbGrips = 2;
+
 	UFUNCTION(BlueprintCallable, Category = "Climb")
 	void RegisterClimbGrip(UPlayerGrabHand* Hand, AActor* ClimbActor);
 
@@ -54,13 +60,26 @@ protected:
 	void StopClimb();
 
 	void HandleVRClimb();
+
+	/**
+	 * PC 臂展约束：在纯数学空间里对相机位置做固定次数的约束投影（逐个投影到每个抓点的臂展球内），
+	 * 最后只做一次带扫掠的位移
+	 */
 	void EnforcePCReachConstraints();
 
 	bool ApplyPlayerOffset(const FVector& Delta, bool bSweep) const;
+
 	bool TraceGroundZ(float& OutGroundZ) const;
 
+	/** 落地高度：优先取最后抓住的攀爬体积烘焙的顶面抓点，没有时用射线检测 */
+	bool FindLandingGroundZ(float& OutGroundZ) const;
+
+	int32 FindGripIndex(const UPlayerGrabHand* Hand) const;
+	void RemoveGripAt(int32 GripIndex);
+
 	void CleanupInvalidHands();
 	void PromoteActiveHand(UPlayerGrabHand* PreferredHand = nullptr);
+	UPlayerGrabHand* GetActiveHand() const;
 
 protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|VR", meta=(ClampMin="1.0"))
@@ -69,6 +88,7 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|PC", meta=(ClampMin="1.0"))
 	float PCArmReachRadius = 180.0f;
 
+	/** 每次约束迭代的最大修正量（一帧最多 PCConstraintIterations 倍） */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|PC", meta=(ClampMin="1.0"))
 	float PCMaxCorrectionPerTick = 60.0f;
 
@@ -78,6 +98,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|Landing", meta=(ClampMin="10.0"))
 	float LandingTraceDistance = 300.0f;
 
+	/** 在烘焙的顶面抓点中查找落脚点的最大水平距离 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|Landing", meta=(ClampMin="1.0"))
+	float LandingGripSearchRadius = 40.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|Landing", meta=(ClampMin="0.01"))
 	float LandingRecoverDuration = 0.2f;
 
@@ -99,8 +123,20 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<ABasePlayer> OwnerPlayer = nullptr;
 
-	TMap<TWeakObjectPtr<UPlayerGrabHand>, FPlayerClimbHandRecord> HandRecords;
-	TWeakObjectPtr<UPlayerGrabHand> ActiveHand;
+	/** 上一帧约束求解的迭代次数 */
+	UPROPERTY(VisibleInstanceOnly, Transient, Category = "Climb|Debug")
+	int32 LastSolverIterations = 0;
+
+	/** 上一帧约束求解耗时（毫秒） */
+	UPROPERTY(VisibleInstanceOnly, Transient, Category = "Climb|Debug")
+	float LastSolverTimeMs = 0.0f;
+
+	/** 抓点（定长数组，下标无固定含义） */
+	TArray<FPlayerClimbHandRecord, TFixedAllocator<MaxClimbGrips>> Grips;
+	int32 ActiveGripIndex = INDEX_NONE;
+
+	/** 最后松开的攀爬物体（落地时查询它的烘焙抓点） */
+	TWeakObjectPtr<AActor> LastClimbActor;
 
 	bool bLandingRecover = false;
 	float LandingElapsed = 0.0f;
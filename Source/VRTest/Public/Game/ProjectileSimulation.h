@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 投射物模拟参数（纯数据，不依赖 Actor/World）
+ *
+ * 加速度 = 重力 + 追踪弹簧 - 速度 * 阻力
+ * 追踪弹簧与 AFakePhysicsHandleActor 原有公式一致：Dir * Stiffness * Clamp(Dist, Min, Max) - V * Damping
+ */
+struct VRTEST_API FProjectileSimParams
+{
+	/** 重力加速度 Z（已乘 GravityScale，通常为 World->GetGravityZ()） */
+	float GravityZ = 0.0f;
+
+	/** 线性阻力系数（1/s） */
+	float LinearDrag = 0.0f;
+
+	/** 最大速度，<= 0 表示不限制 */
+	float MaxSpeed = 0.0f;
+
+	// ==================== 追踪（弹簧） ====================
+
+	bool bHoming = false;
+	FVector HomingTarget = FVector::ZeroVector;
+	float HomingStiffness = 0.0f;
+	float HomingDamping = 0.0f;
+	float HomingDistanceMin = 0.0f;
+	float HomingDistanceMax = 0.0f;
+
+	// ==================== 积分 ====================
+
+	/** 固定步长（秒）：Arrow 飞行、弓的预览、定身球追踪共用同一步长才能保证预览与实际完全一致 */
+	float FixedTimeStep = 1.0f / 120.0f;
+
+	/** 单帧最多积分步数（防止卡顿后追帧爆炸，超出的时间直接丢弃） */
+	int32 MaxStepsPerAdvance = 16;
+};
+
+/**
+ * 投射物模拟状态
+ */
+struct VRTEST_API FProjectileSimState
+{
+	FVector Location = FVector::ZeroVector;
+	FVector Velocity = FVector::ZeroVector;
+
+	/** 上一个固定步长结束时的状态（渲染插值用） */
+	FVector PreviousLocation = FVector::ZeroVector;
+	FVector PreviousVelocity = FVector::ZeroVector;
+
+	/** 尚未消耗的帧时间（不足一个固定步长） */
+	float TimeAccumulator = 0.0f;
+
+	/** 已模拟的总时间 */
+	float SimTime = 0.0f;
+
+	FProjectileSimState() {}
+	FProjectileSimState(const FVector& InLocation, const FVector& InVelocity)
+		: Location(InLocation), Velocity(InVelocity), PreviousLocation(InLocation), PreviousVelocity(InVelocity) {}
+
+	/** 外部直接改写位置/速度（瞬移、弹飞）时调用，避免插值跨过这次跳变 */
+	void SetCurrent(const FVector& InLocation, const FVector& InVelocity)
+	{
+		Location = PreviousLocation = InLocation;
+		Velocity = PreviousVelocity = InVelocity;
+	}
+};
+
+/**
+ * 固定步长投射物积分器（半隐式欧拉）
+ *
+ * Arrow 飞行、Bow 轨迹预览、StasisPoint/FakePhysicsHandle 追踪共用，
+ * 只操作纯数据，可脱离 Actor 批量运行或单独测试。
+ */
+struct VRTEST_API FProjectileSimulation
+{
+	/** 计算当前状态下的加速度 */
+	static FVector ComputeAcceleration(const FProjectileSimState& State, const FProjectileSimParams& Params);
+
+	/** 积分一个固定步长 */
+	static void Step(FProjectileSimState& State, const FProjectileSimParams& Params);
+
+	/**
+	 * 推进一帧：累积 DeltaTime，按固定步长积分
+	 * @return 本帧执行的步数
+	 */
+	static int32 Advance(FProjectileSimState& State, const FProjectileSimParams& Params, float DeltaTime);
+
+	/** 渲染插值系数：剩余累积时间占一个固定步长的比例 [0, 1] */
+	static float GetInterpolationAlpha(const FProjectileSimState& State, const FProjectileSimParams& Params);
+
+	/** 在上一步与当前步之间插值出渲染位置/速度（帧率与固定步长不整除时避免抖动） */
+	static FVector InterpolateLocation(const FProjectileSimState& State, float Alpha);
+	static FVector InterpolateVelocity(const FProjectileSimState& State, float Alpha);
+
+	/**
+	 * 预测轨迹（与 Advance 完全相同的积分路径）
+	 * @param StepsPerSample 每隔多少个固定步长记录一个点
+	 * @param OutPoints 输出点（复用调用方的缓冲，第 i 个点对应时间 i * StepsPerSample * FixedTimeStep）
+	 */
+	static void PredictPath(const FProjectileSimState& Start, const FProjectileSimParams& Params, float MaxSimTime,
+		int32 StepsPerSample, TArray<FVector>& OutPoints);
+};
@@ -0,0 +1,164 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Algo/Impl/BinaryHeap.h"
+#include "Templates/IdentityFunctor.h"
+#include "Game/ActorSpatialIndex.h"
+
+enum class EShapeQueryType : uint8
+{
+	/** 锥形：距离 + 与方向的夹角 */
+	Cone,
+	/** 扇形：水平夹角 + 高度范围（柱状扇区） */
+	Sector,
+	/** 胶囊体：到线段的距离 */
+	Capsule,
+	/** 视锥：6 个平面 */
+	Frustum,
+};
+
+/** 查询命中：空间索引下标 + 得分（越大越好） */
+struct FShapeQueryHit
+{
+	int32 EntryIndex;
+	float Score;
+};
+
+/**
+ * 形状查询（纯数据，不依赖 World）
+ *
+ * - 在 FActorSpatialIndex（各注册表的紧凑数组）上做锥形/扇形/胶囊体/视锥判定，不走物理 Overlap
+ * - 宽相位：形状的包围球交给 ForEachInSphere；窄相位：候选按 4 个一组打包成 SoA，用 VectorRegister 一次判定 4 个
+ * - 判定使用条目的包围球（位置 + 半径），夹角只比较余弦，不做 Acos
+ * - 坐标相对形状原点转成 float，远离世界原点时也不损失精度
+ *
+ * 得分（越大越好）：锥形/扇形为夹角余弦，胶囊体为 -沿线段的距离，视锥为 -沿视线的深度
+ */
+struct VRTEST_API FShapeQuery
+{
+	static constexpr int32 BatchSize = 4;
+
+	/** @param HalfAngleDegrees 半角（度，可大于 90） */
+	static FShapeQuery MakeCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees);
+
+	/** 水平扇形：只看 Direction 的水平分量，高度差不超过 HalfHeight */
+	static FShapeQuery MakeSector(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees, float HalfHeight);
+
+	static FShapeQuery MakeCapsule(const FVector& Start, const FVector& End, float Radius);
+
+	/** @param HalfFOVDegrees 水平半视角；竖直半视角按 AspectRatio（宽/高）换算 */
+	static FShapeQuery MakeFrustum(const FVector& Origin, const FRotator& Rotation, float HalfFOVDegrees, float AspectRatio, float NearDistance, float FarDistance);
+
+	/** 方向为零、范围为负等退化形状返回 false（查询不会有结果） */
+	bool IsValid() const { return bValid; }
+	EShapeQueryType GetType() const { return Type; }
+
+	/** 宽相位用的包围球 */
+	const FVector& GetBoundsCenter() const { return BoundsCenter; }
+	float GetBoundsRadius() const { return BoundsRadius; }
+
+	/** 单个包围球的判定（标量参考实现，与批量判定结果一致） */
+	bool TestSphere(const FVector& Position, float Radius, float& OutScore) const;
+
+	/**
+	 * 批量判定 4 个包围球（相对原点的 SoA，16 字节对齐）
+	 * @return 命中掩码（第 i 位对应第 i 个）
+	 */
+	uint32 TestBatch(const float* RESTRICT X, const float* RESTRICT Y, const float* RESTRICT Z, const float* RESTRICT R, float* RESTRICT OutScores) const;
+
+	/** 在空间索引上查询，命中追加到 OutHits 末尾（不排序） */
+	template <typename AllocatorType>
+	void Collect(const FActorSpatialIndex& Index, TArray<FShapeQueryHit, AllocatorType>& OutHits) const;
+
+	/**
+	 * 只保留得分最高的 MaxResults 个并按得分从高到低排序（有界堆，O(n log K)）
+	 * @param MaxResults <= 0 时全部排序
+	 */
+	template <typename AllocatorType>
+	static void SelectTop(TArray<FShapeQueryHit, AllocatorType>& Hits, int32 MaxResults);
+
+private:
+	/** 判定 Entries 中的条目，命中写入 OutHits（容量至少 Entries.Num()），返回命中数 */
+	int32 TestEntries(const FActorSpatialIndex& Index, TConstArrayView<int32> Entries, FShapeQueryHit* OutHits) const;
+
+	EShapeQueryType Type = EShapeQueryType::Cone;
+	bool bValid = false;
+
+	/** 原点（锥形/扇形/视锥的顶点，胶囊体的起点） */
+	FVector Origin = FVector::ZeroVector;
+
+	/** 单位方向（扇形为水平方向，胶囊体为线段方向，视锥为视线方向） */
+	FVector3f Axis = FVector3f::ForwardVector;
+
+	/** 锥形/扇形：距离；胶囊体：线段长度；视锥：远裁剪距离 */
+	float Range = 0.0f;
+
+	/** 锥形/扇形：半角余弦 */
+	float CosHalfAngle = 1.0f;
+
+	/** 胶囊体：半径 */
+	float Radius = 0.0f;
+
+	/** 扇形：半高 */
+	float HalfHeight = 0.0f;
+
+	/** 视锥：相对原点的平面（XYZ 朝外法线，Dot(N, P) - W > 半径 即在外侧） */
+	FVector4f Planes[6];
+
+	FVector BoundsCenter = FVector::ZeroVector;
+	float BoundsRadius = 0.0f;
+};
+
+template <typename AllocatorType>
+void FShapeQuery::Collect(const FActorSpatialIndex& Index, TArray<FShapeQueryHit, AllocatorType>& OutHits) const
+{
+	if (!bValid)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<256>> Entries;
+	Index.ForEachInSphere(BoundsCenter, BoundsRadius, [&Entries](int32 EntryIndex)
+	{
+		Entries.Add(EntryIndex);
+	});
+
+	if (Entries.Num() == 0)
+	{
+		return;
+	}
+
+	const int32 OldNum = OutHits.Num();
+	OutHits.SetNumUninitialized(OldNum + Entries.Num(), EAllowShrinking::No);
+	const int32 NumHits = TestEntries(Index, Entries, OutHits.GetData() + OldNum);
+	OutHits.SetNum(OldNum + NumHits, EAllowShrinking::No);
+}
+
+template <typename AllocatorType>
+void FShapeQuery::SelectTop(TArray<FShapeQueryHit, AllocatorType>& Hits, int32 MaxResults)
+{
+	auto HigherScore = [](const FShapeQueryHit& A, const FShapeQueryHit& B) { return A.Score > B.Score; };
+
+	if (MaxResults > 0 && MaxResults < Hits.Num())
+	{
+		// 前 K 个建小顶堆（堆顶为当前第 K 名），其余只在更好时替换堆顶
+		auto LowerScore = [](const FShapeQueryHit& A, const FShapeQueryHit& B) { return A.Score < B.Score; };
+		FShapeQueryHit* Heap = Hits.GetData();
+		AlgoImpl::HeapifyInternal(Heap, MaxResults, FIdentityFunctor(), LowerScore);
+
+		for (int32 Index = MaxResults; Index < Hits.Num(); ++Index)
+		{
+			if (Hits[Index].Score > Heap[0].Score)
+			{
+				Heap[0] = Hits[Index];
+				AlgoImpl::HeapSiftDown(Heap, 0, MaxResults, FIdentityFunctor(), LowerScore);
+			}
+		}
+
+		Hits.SetNum(MaxResults, EAllowShrinking::No);
+	}
+
+	Hits.Sort(HigherScore);
+}
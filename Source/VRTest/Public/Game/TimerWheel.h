@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+/** 时间轮中的一条定时 */
+struct FTimerWheelEntry
+{
+	/** 定时所属对象 */
+	FObjectKey Key;
+
+	/** 调用方自定义的类别（同一对象可有多种定时） */
+	uint8 Tag = 0;
+
+	/** 定时编号：调用方保存最新编号，到期时编号不一致说明已被取消/覆盖 */
+	uint32 Id = 0;
+
+	/** 到期的刻度 */
+	int64 ExpireTick = 0;
+};
+
+/**
+ * 时间轮（纯数据，不依赖 World）
+ *
+ * - 时间按固定刻度离散，定时放入 ExpireTick % NumSlots 的槽；超过一圈的定时留在槽里等下一圈
+ * - Advance 只检查从上次推进到现在经过的槽，代价与到期数量相关，与定时总数无关
+ * - 取消采用惰性方式：不从槽中删除，调用方在到期时比较 Id
+ *
+ * 用于替代大量 FTimerHandle（每个对象一个定时器）的场景。
+ */
+struct VRTEST_API FTimerWheel
+{
+	explicit FTimerWheel(float InResolution = 0.05f, int32 InNumSlots = 128);
+
+	/** 清空（从 Now 开始计时） */
+	void Reset(double Now);
+
+	/**
+	 * 添加定时
+	 * @return 定时编号
+	 */
+	uint32 Schedule(double ExpireTime, const FObjectKey& Key, uint8 Tag = 0);
+
+	/** 推进到 Now，把到期的定时追加到 OutExpired */
+	void Advance(double Now, TArray<FTimerWheelEntry>& OutExpired);
+
+	/** 槽中的定时数量（含已被惰性取消的） */
+	int32 Num() const { return NumEntries; }
+
+	float GetResolution() const { return Resolution; }
+
+private:
+	int64 TimeToTick(double Time) const { return FMath::CeilToInt64(Time / Resolution); }
+
+	float Resolution;
+	TArray<TArray<FTimerWheelEntry>> Slots;
+
+	/** 已处理到的刻度 */
+	int64 CurrentTick = 0;
+
+	uint32 NextId = 1;
+	int32 NumEntries = 0;
+};
@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+#include "VRBodyZone.generated.h"
+
+/**
+ * 身体区域类型（手伸到身体附近的取物区）
+ */
+UENUM(BlueprintType)
+enum class EVRBodyZone : uint8
+{
+	None,
+	Backpack,  // 背包（肩后）：取/放箭
+	Quiver,    // 箭袋：取/放箭
+	Holster    // 枪套/腰挂：仅上报，由蓝图处理
+};
+
+/**
+ * 身体区域形状（纯数据）
+ *
+ * 定义在“身体坐标系”中：原点为 HMD 位置，只跟随 HMD 的 Yaw（低头、仰头不会带动腰间区域）。
+ * 每帧用几次点积判断手是否在区域内，不依赖物理重叠。
+ */
+USTRUCT(BlueprintType)
+struct VRTEST_API FVRBodyZone
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|BodyZone")
+	EVRBodyZone Zone = EVRBodyZone::None;
+
+	/** 盒子中心（身体坐标系，X 前 / Y 右 / Z 上） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|BodyZone")
+	FVector Center = FVector::ZeroVector;
+
+	/** 盒子半尺寸 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|BodyZone", meta=(ClampMin="0.0"))
+	FVector HalfExtent = FVector(10.0f);
+
+	/** 是否只对某一只手生效（例如右侧腰挂只给右手），AnyHand 表示双手都可用 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|BodyZone")
+	EControllerHand Hand = EControllerHand::AnyHand;
+
+	/**
+	 * 球（手）与盒子是否相交
+	 * @param LocalPoint 手在区域所在坐标系中的位置
+	 * @param Radius 手的碰撞半径（含退出余量）
+	 */
+	bool Overlaps(const FVector& LocalPoint, float Radius) const;
+
+	/** 该区域是否对指定手生效 */
+	bool AcceptsHand(bool bIsRightHand) const;
+};
+
+namespace VRBodyZone
+{
+	/** 由 HMD 位姿构建身体坐标系（HMD 位置 + 仅 Yaw 的旋转） */
+	VRTEST_API FTransform MakeBodyFrame(const FVector& HeadLocation, const FRotator& HeadRotation);
+
+	/** 背包、箭袋这类可以存取箭的区域 */
+	inline bool IsArrowStorage(EVRBodyZone Zone)
+	{
+		return Zone == EVRBodyZone::Backpack || Zone == EVRBodyZone::Quiver;
+	}
+}
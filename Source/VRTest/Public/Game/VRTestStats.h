@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * 项目统计组（控制台：stat VRTest）
+ */
+DECLARE_STATS_GROUP(TEXT("VRTest"), STATGROUP_VRTest, STATCAT_Advanced);
+
+/** 当前启用 Custom Depth 的 Primitive 数量（高亮描边） */
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Custom Depth Primitives"), STAT_VRTest_CustomDepthPrimitives, STATGROUP_VRTest, VRTEST_API);
+
+/** 攀爬约束求解 */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Climb Solve"), STAT_VRTest_ClimbSolve, STATGROUP_VRTest, VRTEST_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Climb Solver Iterations"), STAT_VRTest_ClimbSolverIterations, STATGROUP_VRTest, VRTEST_API);
+
+/** 放置服务（地面投影 + 空位检测） */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Drop Placement"), STAT_VRTest_DropPlacement, STATGROUP_VRTest, VRTEST_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Drop Ground Samples"), STAT_VRTest_DropGroundSamples, STATGROUP_VRTest, VRTEST_API);
+
+/** 定身目标查询（可定身物注册表） */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stasis Target Query"), STAT_VRTest_StasisTargetQuery, STATGROUP_VRTest, VRTEST_API);
+
+/** 弹簧追踪批量积分（定身球 / FakePhysicsHandle） */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Fake Physics Update"), STAT_VRTest_FakePhysicsUpdate, STATGROUP_VRTest, VRTEST_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Fake Physics Handles"), STAT_VRTest_FakePhysicsHandles, STATGROUP_VRTest, VRTEST_API);
+
+/** 形状查询（锥形/扇形/胶囊体/视锥，注册表上的批量判定） */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Shape Query"), STAT_VRTest_ShapeQuery, STATGROUP_VRTest, VRTEST_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Shape Query Candidates"), STAT_VRTest_ShapeQueryCandidates, STATGROUP_VRTest, VRTEST_API);
+
+/** 效果队列（入队的命中数 / 合并后实际结算的 ApplyEffect 次数） */
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Effect Resolve"), STAT_VRTest_EffectResolve, STATGROUP_VRTest, VRTEST_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effects Queued"), STAT_VRTest_EffectsQueued, STATGROUP_VRTest, VRTEST_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Effects Resolved"), STAT_VRTest_EffectsResolved, STATGROUP_VRTest, VRTEST_API);
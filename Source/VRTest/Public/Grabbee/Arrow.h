@@ -5,11 +5,13 @@
 #include "CoreMinimal.h"
 #include "Grabbee/GrabbeeWeapon.h"
 #include "Effect/Effectable.h"
+#include "Game/ProjectileSimulation.h"
 #include "Arrow.generated.h"
 
 class UProjectileMovementComponent;
 class UNiagaraComponent;
 class ABow;
+class UArrowImpactAsset;
 
 /**
  * 箭 - 可抓取武器
@@ -17,7 +19,7 @@ class ABow;
  * 状态机：
  * - Idle: 闲置状态，可被抓取，启用物理
  * - Nocked: 搭在弓弦上，禁用物理，跟随弓弦位置
- * - Flying: 飞行中，使用 ProjectileMovement
+ * - Flying: 飞行中，由 FProjectileSimulation 固定步长积分（与弓的轨迹预览共用同一积分器）
  * - Stuck: 插在目标上
  * 
  * VR模式：玩家抓取箭 → 靠近弓弦 → 搭箭 → 拉弦 → 释放发射
@@ -40,7 +42,7 @@ public:
 
 	// ==================== 组件 ====================
 	
-	/** 投射物移动组件 */
+	/** 投射物移动组件（保留以兼容蓝图；飞行运动由 FProjectileSimulation 驱动，组件始终不激活） */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UProjectileMovementComponent* ProjectileMovement;
 
@@ -72,6 +74,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arrow|Combat")
 	float ImpulseStrengthMultiplier = 2.0f;
 
+	/** 命中模型（插入深度/弹飞/骨骼伤害倍率）；为空时使用 GameSettings 的 ArrowImpactAsset */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arrow|Combat")
+	TObjectPtr<UArrowImpactAsset> ImpactAsset;
+
+	// ==================== 飞行 ====================
+
+	/** 飞行重力缩放 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arrow|Flight")
+	float FlightGravityScale = 1.0f;
+
+	/** 飞行线性阻力（1/s），0 为无阻力 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Arrow|Flight", meta=(ClampMin="0.0"))
+	float FlightLinearDrag = 0.0f;
+
 	// ==================== 状态 ====================
 	
 	/** 当前箭的状态 */
@@ -114,6 +130,28 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Arrow|State")
 	void EnterStuckState(USceneComponent* HitComponent, FName BoneName);
 
+	/** 进入池化状态 - 解除附着，隐藏并关闭碰撞/Tick/特效，等待对象池复用 */
+	UFUNCTION(BlueprintCallable, Category = "Arrow|State")
+	void EnterPooledState();
+
+	/**
+	 * 从对象池取出时重置箭（Niagara、ProjectileMovement、命中/火焰状态），并以 Idle 状态出现在指定位置
+	 * @param SpawnTransform 出现位置
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Arrow|State")
+	void ResetForReuse(const FTransform& SpawnTransform);
+
+	/** 进入当前状态时的世界时间（对象池按存在时间回收时使用） */
+	float GetStateEnterTime() const { return StateEnterTime; }
+
+	/**
+	 * 以指定速度发射时的飞行模拟参数（弓的轨迹预览用同一组参数，保证预览与实际飞行一致）
+	 */
+	FProjectileSimParams MakeFlightSimParams(float LaunchSpeed) const;
+
+	/** 当前飞行速度（仅 Flying 状态有效） */
+	const FVector& GetFlightVelocity() const { return FlightState.Velocity; }
+
 	// ==================== 火焰效果 ====================
 	
 	/** 点燃箭 */
@@ -148,11 +186,14 @@ protected:
 	/** 飞行时执行 LineTrace 检测碰撞 */
 	void PerformFlightTrace(float DeltaTime);
 
-	/** 处理命中 */
+	/** 处理命中（按命中模型决定插入/弹飞/弹落） */
 	void HandleHit(const FHitResult& HitResult);
 
-	/** 造成伤害 */
-	void DealDamage(AActor* HitActor);
+	/** 弹飞：沿反射速度继续飞行 */
+	void HandleRicochet(const FHitResult& HitResult, const FVector& NewVelocity);
+
+	/** 造成伤害（DamageScale 为材质/骨骼倍率） */
+	void DealDamage(AActor* HitActor, float DamageScale = 1.0f);
 
 	/** 火焰计时器回调 */
 	void OnFireTimerExpired();
@@ -163,6 +204,19 @@ protected:
 	/** 上一帧箭头位置（用于 LineTrace） */
 	FVector PreviousTipLocation;
 
+	/** 飞行模拟状态与参数 */
+	FProjectileSimState FlightState;
+	FProjectileSimParams FlightParams;
+
+	/** 本次飞行已弹飞的次数 */
+	int32 RicochetCount = 0;
+
+	/** 进入当前状态时的世界时间 */
+	float StateEnterTime = 0.0f;
+
+	/** 记录状态切换时间 */
+	void MarkStateEnterTime();
+
 	/** 当前插中的目标 Actor（用于在目标 EndPlay 时解除附着并恢复 Idle） */
 	UPROPERTY(Transient)
 	TObjectPtr<AActor> AttachedTargetActor = nullptr;
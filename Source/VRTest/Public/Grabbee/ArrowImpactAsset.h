@@ -0,0 +1,161 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/ObjectKey.h"
+#include "ArrowImpactAsset.generated.h"
+
+class UPhysicalMaterial;
+class USkinnedMeshComponent;
+
+/** 箭命中后的结果 */
+UENUM(BlueprintType)
+enum class EArrowImpactOutcome : uint8
+{
+	Stick		UMETA(DisplayName = "插入"),
+	Ricochet	UMETA(DisplayName = "弹飞（继续飞行）"),
+	Drop		UMETA(DisplayName = "弹落（进入 Idle）")
+};
+
+/**
+ * 单种物理材质的命中参数
+ */
+USTRUCT(BlueprintType)
+struct FArrowImpactProfile
+{
+	GENERATED_BODY()
+
+	/** 是否可以插入（金属、石头等可关闭，只会弹落/弹飞） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact")
+	bool bCanStick = true;
+
+	/** 法向速度低于此值时插不进去，直接弹落（cm/s） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact", meta=(ClampMin="0.0"))
+	float MinStickSpeed = 500.0f;
+
+	/** 每 1000 cm/s 法向速度的插入深度（cm） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact", meta=(ClampMin="0.0"))
+	float PenetrationPer1000Speed = 5.0f;
+
+	/** 最大插入深度（cm） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact", meta=(ClampMin="0.0"))
+	float MaxPenetrationDepth = 15.0f;
+
+	/** 弹飞角（度）：速度与表面的夹角小于此值时弹飞，0 为从不弹飞 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact", meta=(ClampMin="0.0", ClampMax="90.0"))
+	float RicochetAngle = 15.0f;
+
+	/** 弹飞/弹落后保留的速度比例 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float RicochetSpeedRetention = 0.6f;
+
+	/** 伤害倍率（插入/弹落时生效，弹飞不造成伤害） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact", meta=(ClampMin="0.0"))
+	float DamageMultiplier = 1.0f;
+};
+
+/**
+ * 命中评估结果
+ */
+struct FArrowImpactResult
+{
+	EArrowImpactOutcome Outcome = EArrowImpactOutcome::Stick;
+
+	/** 插入深度（cm，仅 Stick） */
+	float StickDepth = 0.0f;
+
+	/** 命中后的速度（Ricochet/Drop） */
+	FVector OutVelocity = FVector::ZeroVector;
+
+	/** 材质倍率 * 骨骼倍率 */
+	float DamageMultiplier = 1.0f;
+};
+
+/**
+ * ArrowImpactAsset：箭的命中模型配置
+ *
+ * - 物理材质 -> 命中参数（插入深度、弹飞角、伤害倍率），未配置的材质使用 DefaultProfile
+ * - 骨骼 -> 伤害倍率，未配置的骨骼沿父骨骼向上查找（如 "head" 覆盖其下所有子骨骼）
+ *
+ * 运行时只查预处理好的缓存（弹飞角预先换算成 sin 阈值），命中时不做额外的射线检测；
+ * 物理材质来自飞行 LineTrace 本身的 HitResult。
+ */
+UCLASS(BlueprintType)
+class VRTEST_API UArrowImpactAsset : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// ==================== 材质配置 ====================
+
+	/** 未配置物理材质时使用的参数 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact")
+	FArrowImpactProfile DefaultProfile;
+
+	/** 物理材质 -> 命中参数 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact")
+	TMap<TObjectPtr<UPhysicalMaterial>, FArrowImpactProfile> MaterialProfiles;
+
+	/** 一支箭最多弹飞次数，超出后按弹落处理 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact", meta=(ClampMin="0"))
+	int32 MaxRicochets = 2;
+
+	// ==================== 骨骼配置 ====================
+
+	/** 骨骼 -> 伤害倍率（子骨骼继承最近的已配置父骨骼） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact|Bone")
+	TMap<FName, float> BoneDamageMultipliers;
+
+	/** 骨骼及其所有父骨骼都未配置时的伤害倍率 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Arrow|Impact|Bone", meta=(ClampMin="0.0"))
+	float DefaultBoneDamageMultiplier = 1.0f;
+
+	// ==================== 查询 ====================
+
+	/**
+	 * 评估一次命中
+	 * @param PhysMaterial 命中表面的物理材质（可为空）
+	 * @param ImpactNormal 命中表面法线
+	 * @param Velocity 命中时的速度
+	 * @param RicochetCount 这支箭已经弹飞的次数
+	 */
+	void EvaluateImpact(const UPhysicalMaterial* PhysMaterial, const FVector& ImpactNormal, const FVector& Velocity,
+		int32 RicochetCount, FArrowImpactResult& OutResult) const;
+
+	/** 骨骼伤害倍率（沿父骨骼向上查找，结果按（骨骼网格资产, 骨骼名）缓存） */
+	float GetBoneDamageMultiplier(const USkinnedMeshComponent* SkinnedMesh, FName BoneName) const;
+
+protected:
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** 预处理后的命中参数 */
+	struct FCachedProfile
+	{
+		FArrowImpactProfile Profile;
+
+		/** sin(RicochetAngle)：-dot(速度方向, 法线) 小于此值即为弹飞 */
+		float RicochetSinThreshold = 0.0f;
+
+		/** 插入深度 / 法向速度 */
+		float DepthPerSpeed = 0.0f;
+	};
+
+	void RebuildImpactCache();
+	static FCachedProfile MakeCachedProfile(const FArrowImpactProfile& Profile);
+
+	/** 运行时缓存：物理材质 -> 预处理参数 */
+	TMap<const UPhysicalMaterial*, FCachedProfile> CachedProfiles;
+	FCachedProfile CachedDefaultProfile;
+
+	/**
+	 * 运行时缓存：（骨骼网格资产, 骨骼名）-> 解析后的伤害倍率（首次命中该骨骼时沿父骨骼解析）
+	 * 本资产被所有箭共用，不同网格的同名骨骼父子关系可能不同，必须带上网格资产
+	 */
+	mutable TMap<TPair<FObjectKey, FName>, float> ResolvedBoneMultipliers;
+};
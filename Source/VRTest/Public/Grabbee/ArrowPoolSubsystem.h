@@ -0,0 +1,170 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ArrowPoolSubsystem.generated.h"
+
+class AArrow;
+class APawn;
+class UStaticMesh;
+class USceneComponent;
+class UInstancedStaticMeshComponent;
+
+/** 同一种箭网格的实例批次（环形缓冲：达到预算后覆盖最早的实例） */
+USTRUCT()
+struct FStuckArrowInstanceBatch
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TObjectPtr<UInstancedStaticMeshComponent> Component = nullptr;
+
+	/** 下一次覆盖的实例下标（仅在达到预算后使用） */
+	int32 NextSlot = 0;
+};
+
+/**
+ * 箭对象池（World 级子系统）
+ *
+ * - 开局预生成 N 支箭并隐藏，取箭时直接复用，避免连射时 SpawnActor 卡顿
+ * - 场景中箭的总数有上限：池空且达到上限时，按“存在时间 + 与取箭点距离”回收 Stuck/Idle 的箭
+ * - 放回背包的箭回到池中而不是 Destroy
+ * - 插在静态场景上的箭一段时间后转成实例化网格（每种网格有预算，FIFO 覆盖），Actor 回到池中；
+ *   插在会动的 Actor 上的箭保持为真实 Actor
+ * - 统计命中（复用）/未命中（新生成）/回收次数
+ *
+ * 配置见 GameSettings 的 Bow|Pool 分类。
+ */
+UCLASS()
+class VRTEST_API UArrowPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的箭对象池，非游戏世界返回 nullptr */
+	static UArrowPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 把箭还给对象池；不是箭或没有对象池时直接 Destroy（放入背包时调用） */
+	static void ReturnToPoolOrDestroy(AActor* ArrowActor);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// ==================== 取/还 ====================
+
+	/**
+	 * 取出一支箭（Idle 状态，出现在 SpawnTransform）
+	 * 顺序：空闲池 → 未达上限则新生成 → 回收场景中最旧/最远的 Stuck/Idle 箭 → 兜底新生成
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Arrow|Pool")
+	AArrow* AcquireArrow(const FTransform& SpawnTransform, AActor* NewOwner, APawn* NewInstigator);
+
+	/** 归还一支箭（隐藏并进入 Pooled 状态） */
+	UFUNCTION(BlueprintCallable, Category = "Arrow|Pool")
+	void ReleaseArrow(AArrow* Arrow);
+
+	/** 预生成箭直到空闲池达到 Count 支（受上限约束） */
+	UFUNCTION(BlueprintCallable, Category = "Arrow|Pool")
+	void Prewarm(int32 Count);
+
+	// ==================== 插入箭实例化 ====================
+
+	/** 箭进入 Stuck 状态时调用：插在静态组件上的箭登记为待实例化 */
+	void NotifyArrowStuck(AArrow* Arrow, const USceneComponent* HitComponent);
+
+	/** 清空所有已实例化的箭 */
+	UFUNCTION(BlueprintCallable, Category = "Arrow|Pool")
+	void ClearInstancedArrows();
+
+	// ==================== 统计 ====================
+
+	/** 从空闲池直接复用的次数 */
+	UFUNCTION(BlueprintPure, Category = "Arrow|Pool")
+	int32 GetHitCount() const { return HitCount; }
+
+	/** 空闲池为空、不得不 SpawnActor 的次数 */
+	UFUNCTION(BlueprintPure, Category = "Arrow|Pool")
+	int32 GetMissCount() const { return MissCount; }
+
+	/** 回收场景中 Stuck/Idle 箭的次数 */
+	UFUNCTION(BlueprintPure, Category = "Arrow|Pool")
+	int32 GetRecycleCount() const { return RecycleCount; }
+
+	UFUNCTION(BlueprintPure, Category = "Arrow|Pool")
+	int32 GetFreeCount() const { return FreeArrows.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Arrow|Pool")
+	int32 GetLiveCount() const { return LiveArrows.Num(); }
+
+	/** 转成实例的次数 */
+	UFUNCTION(BlueprintPure, Category = "Arrow|Pool")
+	int32 GetInstancedCount() const { return InstancedCount; }
+
+	/** 因预算已满而覆盖旧实例的次数 */
+	UFUNCTION(BlueprintPure, Category = "Arrow|Pool")
+	int32 GetInstanceEvictCount() const { return InstanceEvictCount; }
+
+protected:
+	/** 生成一支处于 Pooled 状态的箭 */
+	AArrow* SpawnPooledArrow();
+
+	/** 在场景中的箭里挑选回收目标（只考虑未被持有/选中的 Stuck/Idle 箭） */
+	AArrow* FindRecycleCandidate(const FVector& RequestLocation) const;
+
+	/** 清理已被外部销毁的箭 */
+	void PruneInvalidArrows();
+
+	/** 定时检查待实例化的箭（一个计时器处理所有箭） */
+	void ProcessPendingStuckArrows();
+
+	/** 把箭的当前外观写入实例批次，然后把 Actor 还回池中 */
+	bool ConvertArrowToInstance(AArrow* Arrow);
+
+	/** 获取/创建某种箭网格的实例批次 */
+	FStuckArrowInstanceBatch* FindOrCreateInstanceBatch(UStaticMesh* Mesh, const AArrow* SourceArrow);
+
+	UPROPERTY(Transient)
+	TSubclassOf<AArrow> ArrowClass;
+
+	/** 空闲（隐藏）的箭 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AArrow>> FreeArrows;
+
+	/** 已取出、存在于场景中的箭 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AArrow>> LiveArrows;
+
+	/** 插在静态组件上、等待转成实例的箭 */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AArrow>> PendingStuckArrows;
+
+	/** 承载实例组件的 Actor（首次实例化时生成） */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> InstanceHolder;
+
+	/** 箭网格 -> 实例批次 */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UStaticMesh>, FStuckArrowInstanceBatch> InstanceBatches;
+
+	FTimerHandle StuckArrowTimerHandle;
+
+	int32 MaxArrowCount = 32;
+	float RecycleAgeWeight = 1.0f;
+	float RecycleDistanceWeight = 0.5f;
+
+	bool bInstanceStuckArrows = true;
+	float StuckArrowInstanceDelay = 5.0f;
+	int32 StuckArrowInstanceBudget = 128;
+
+	/** 待实例化检查间隔（秒） */
+	static constexpr float StuckArrowCheckInterval = 0.5f;
+
+	int32 HitCount = 0;
+	int32 MissCount = 0;
+	int32 RecycleCount = 0;
+	int32 InstancedCount = 0;
+	int32 InstanceEvictCount = 0;
+};
@@ -11,6 +11,7 @@ class UNiagaraComponent;
 class AArrow;
 class UPlayerGrabHand;
 class ABasePlayer;
+struct FProjectileSimParams;
 
 
 /**
@@ -87,6 +88,47 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|Config")
 	float StringSpringDamping = 15.0f;
 
+	// ==================== 轨迹预览配置 ====================
+
+	/**
+	 * 轨迹预览模式（轨迹点与箭的飞行积分器 FProjectileSimulation 一致：无阻力时用离散积分的闭式解，否则逐步积分）：
+	 * true  - 仅在发射参数变化超过阈值/定期刷新时沿轨迹做碰撞查询
+	 * false - 每帧沿轨迹做碰撞查询
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview")
+	bool bUseCachedTracePreview = true;
+
+	/** 轨迹预览最大模拟时间（秒） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.1"))
+	float TracePreviewMaxSimTime = 3.0f;
+
+	/** 轨迹预览点的时间间隔（秒，会取整到积分步长的整数倍） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.005"))
+	float TracePreviewTimeStep = 0.05f;
+
+	/** 发射速度变化超过该值（cm/s）才重新做碰撞查询 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.0"))
+	float TracePreviewVelocityThreshold = 30.0f;
+
+	/** 发射点移动超过该值（cm）才重新做碰撞查询 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.0"))
+	float TracePreviewLocationThreshold = 2.0f;
+
+	/** 轨迹点缓存的量化精度：发射点（cm）/ 发射速度（cm/s）落在同一格内时复用上次生成的轨迹点 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.01"))
+	float TracePreviewLocationQuantum = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.01"))
+	float TracePreviewVelocityQuantum = 5.0f;
+
+	/** 两次碰撞查询之间的最短间隔（秒），用于限制持续瞄准移动时的查询频率 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.0"))
+	float TracePreviewMinQueryInterval = 0.05f;
+
+	/** 发射参数不变时也定期刷新碰撞（秒），以跟上移动的物体 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bow|TracePreview", meta=(ClampMin="0.0"))
+	float TracePreviewMaxQueryInterval = 0.25f;
+
 	// ==================== 状态 ====================
 	
 	/** 弓身是否被抓取 */
@@ -214,6 +256,45 @@ protected:
 	/** 弓弦回弹速度（用于弹簧计算） */
 	FVector StringVelocity = FVector::ZeroVector;
 
+	// ==================== 轨迹预览缓存 ====================
+
+	/** 标记轨迹预览需要重新查询碰撞并推送给 Niagara（预览显示/隐藏时调用） */
+	void InvalidateTracePreview();
+
+	/**
+	 * 生成完整轨迹点到 TracePreviewPathPoints
+	 * 只受重力（无阻力、速度上限不会触发）时用半隐式欧拉的闭式解直接求各采样点，否则逐步积分
+	 */
+	void BuildTracePreviewPath(const FVector& Start, const FVector& LaunchVelocity, const FProjectileSimParams& SimParams, int32 StepsPerSample);
+
+	/** 沿 TracePreviewPathPoints 逐段做 LineTrace，返回命中时间（未命中返回最大模拟时间） */
+	float QueryTracePreviewHitTime(float SampleInterval) const;
+
+	/** 把 TracePreviewPoints 截断到 EndTime（末点插值到命中位置） */
+	void TruncateTracePreviewPoints(float SampleInterval, float EndTime);
+
+	/** 完整轨迹点（按量化后的发射参数缓存） */
+	TArray<FVector> TracePreviewPathPoints;
+
+	/** 截断到命中点后推送给 Niagara 的轨迹点（复用缓冲，避免每帧分配） */
+	TArray<FVector> TracePreviewPoints;
+
+	/** TracePreviewPathPoints 对应的量化发射点/速度 */
+	FIntVector CachedPathStartKey = FIntVector::ZeroValue;
+	FIntVector CachedPathVelocityKey = FIntVector::ZeroValue;
+
+	/** 上次碰撞查询时的发射点/速度/时间/命中时间 */
+	FVector LastQueryStart = FVector::ZeroVector;
+	FVector LastQueryVelocity = FVector::ZeroVector;
+	float LastQueryTime = -1.0f;
+	float CachedTraceHitTime = 0.0f;
+
+	/** 上次推送给 Niagara 的命中时间（轨迹与命中时间都没变则跳过推送） */
+	float LastPushedEndTime = -1.0f;
+
+	/** 是否需要强制刷新（预览重新显示时） */
+	bool bTracePreviewDirty = true;
+
 	/** 当前处于弓弦碰撞区域内的手（用于判断是否允许抓弦） */
 	UPROPERTY(Transient)
 	TObjectPtr<UPlayerGrabHand> InStringCollisionHand = nullptr;
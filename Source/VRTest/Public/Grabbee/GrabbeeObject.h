@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
 #include "Grabber/GrabTypes.h"
 #include "Grabber/IGrabbable.h"
 #include "Skill/Stasis/IStasisable.h"
@@ -31,6 +32,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	UPROPERTY(Transient)
 	TObjectPtr<UAudioSubsystem> CachedAudioSubsystem = nullptr;
@@ -87,8 +89,8 @@ public:
 	virtual bool SupportsDualHandGrab_Implementation() const override;
 	virtual void OnGrabbed_Implementation(UPlayerGrabHand* Hand) override;
 	virtual void OnReleased_Implementation(UPlayerGrabHand* Hand) override;
-	virtual void OnGrabSelected_Implementation() override;
-	virtual void OnGrabDeselected_Implementation() override;
+	virtual void OnGrabSelected_Implementation(UPlayerGrabHand* Hand) override;
+	virtual void OnGrabDeselected_Implementation(UPlayerGrabHand* Hand) override;
 	
 	// ==================== IStasisable 接口实现 ====================
 	
@@ -120,7 +122,13 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Grab")
 	void ForceRelease();
+
+	/** 取消所有手的选中并撤销高亮（被抓取、回收进对象池时调用） */
+	void ClearGrabSelection();
 	
 protected:
-	bool bIsInStasis;
+	bool bIsInStasis = false;
+
+	/** 当前选中此物体的手（高亮按手计数，存 Key 以便手已销毁时仍能撤销） */
+	TArray<FObjectKey, TInlineAllocator<2>> SelectingHands;
 };
@@ -0,0 +1,144 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/HitResult.h"
+#include "UObject/ObjectKey.h"
+#include "DropPlacementSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 一个放置请求
+ */
+struct FDropPlacementRequest
+{
+	/** 要放置的物体（移动的是这个 Primitive） */
+	UPrimitiveComponent* Primitive = nullptr;
+
+	/** 期望位置（射线命中点、存档位置等），最终落在其下方的地面上 */
+	FVector DesiredLocation = FVector::ZeroVector;
+
+	/** 放置后的旋转 */
+	FQuat Rotation = FQuat::Identity;
+
+	/**
+	 * 瞄准射线命中的表面（bHasSurfaceHit 为 true 时有效）
+	 * 法线朝上时直接放在命中点上（桌面、动态物体、台阶、斜坡、架子），周围候选点也优先在命中的组件上找
+	 */
+	FHitResult SurfaceHit;
+	bool bHasSurfaceHit = false;
+};
+
+/**
+ * 一个放置结果
+ */
+struct FDropPlacementResult
+{
+	/** Primitive 的最终位置 */
+	FVector Location = FVector::ZeroVector;
+
+	/** 是否找到了落脚点并已移动 */
+	bool bPlaced = false;
+};
+
+/**
+ * 放置服务（World 级子系统）
+ *
+ * 把物体放到期望位置下方的地面上：
+ * - 有瞄准命中且命中面朝上时直接用命中点，不查缓存
+ * - 周围候选点先在命中的组件上找落脚点：静态组件按（组件, 格子）缓存，可移动组件每次直接检测该组件
+ * - 没有命中、命中面朝侧面或组件上找不到时，才用场景地面缓存（XY 格子 + Z 分层），
+ *   来源为 NavMesh 投影或一次向下射线（只查 WorldStatic），同一区域内的多次放置共用采样
+ * - 空位检测每个候选点只做一次重叠测试（按物体自身的碰撞通道/响应），被占用时在周围几圈候选点中寻找
+ * - 批量放置时已放下的物体互相避让，且不受彼此原位置的影响，用于一次丢下多个物体或读档恢复
+ * - 找到位置后直接传送，不做 Sweep
+ */
+UCLASS()
+class VRTEST_API UDropPlacementSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的放置服务，非游戏世界返回 nullptr */
+	static UDropPlacementSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// ==================== 放置 ====================
+
+	/**
+	 * 放置单个物体
+	 * @param OutLocation 成功时输出 Primitive 的最终位置
+	 * @param SurfaceHit 瞄准射线的命中结果（可选），见 FDropPlacementRequest::SurfaceHit
+	 * @return 是否找到落脚点（失败时物体不移动）
+	 */
+	bool PlaceComponent(UPrimitiveComponent* Primitive, const FVector& DesiredLocation, const FQuat& Rotation, FVector& OutLocation,
+		const FHitResult* SurfaceHit = nullptr);
+
+	/**
+	 * 批量放置（结果与 Requests 一一对应）
+	 * @return 成功放置的数量
+	 */
+	int32 PlaceComponents(TArrayView<const FDropPlacementRequest> Requests, TArray<FDropPlacementResult>& OutResults);
+
+	/**
+	 * 只计算落脚点，不移动物体
+	 * @param Occupied 额外需要避让的包围盒（批量放置中已确定的位置）
+	 * @param IgnoredActors 重叠测试时忽略的 Actor
+	 */
+	bool FindPlacement(const FDropPlacementRequest& Request, FVector& OutLocation,
+		TArrayView<const FBox> Occupied = TArrayView<const FBox>(), TArrayView<const AActor* const> IgnoredActors = TArrayView<const AActor* const>());
+
+	// ==================== 地面缓存 ====================
+
+	/**
+	 * 查询 Location 下方的地面高度
+	 * @param Surface 只在这个组件上找（nullptr = 场景静态地面）；可移动组件不缓存
+	 * @return 该处下方是否有地面
+	 */
+	bool FindGroundZ(const FVector& Location, float& OutGroundZ, UPrimitiveComponent* Surface = nullptr);
+
+	/** 清空地面缓存（关卡流送、场景破坏后调用） */
+	UFUNCTION(BlueprintCallable, Category = "Grab|Drop")
+	void InvalidateGroundCache();
+
+	UFUNCTION(BlueprintPure, Category = "Grab|Drop")
+	int32 GetCachedGroundCellCount() const { return GroundCells.Num(); }
+
+protected:
+	struct FGroundCell
+	{
+		float GroundZ = 0.0f;
+		double SampleTime = 0.0;
+		bool bHasGround = false;
+	};
+
+	/** 缓存键：表面组件（场景地面为空）+ 格子 */
+	struct FGroundCellKey
+	{
+		FObjectKey Surface;
+		FIntVector Cell = FIntVector::ZeroValue;
+
+		bool operator==(const FGroundCellKey& Other) const
+		{
+			return Surface == Other.Surface && Cell == Other.Cell;
+		}
+
+		friend uint32 GetTypeHash(const FGroundCellKey& Key)
+		{
+			return HashCombine(GetTypeHash(Key.Surface), GetTypeHash(Key.Cell));
+		}
+	};
+
+	/** 采样一个格子的地面高度（Surface 非空时只检测该组件，否则 NavMesh 或向下射线） */
+	void SampleGroundCell(const FIntVector& CellKey, UPrimitiveComponent* Surface, FGroundCell& OutCell) const;
+
+	/** 格子键：XY 按格子尺寸、Z 按分层高度量化 */
+	FIntVector GetCellKey(const FVector& Location) const;
+
+	TMap<FGroundCellKey, FGroundCell> GroundCells;
+};
@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GrabConstraintDriverSubsystem.generated.h"
+
+class UPlayerGrabHand;
+class UGrabConstraintDriverSubsystem;
+class UPhysicsHandleComponent;
+class FPhysScene_Chaos;
+
+/**
+ * 抓取约束驱动的 Tick 函数
+ * 排在手部父组件（MotionController）之后、PhysicsHandle 之前执行
+ */
+USTRUCT()
+struct FGrabConstraintDriverTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	UGrabConstraintDriverSubsystem* Driver = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGrabConstraintDriverTickFunction> : public TStructOpsTypeTraitsBase2<FGrabConstraintDriverTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
+/**
+ * 抓取约束驱动（World 级子系统）
+ *
+ * 所有手的 PhysicsHandle 目标在同一个 Tick 函数里统一更新：
+ * - Tick 顺序：MotionController 更新位姿 → 本驱动 → PhysicsHandle（插值并写入物理）→ 物理步进，
+ *   目标总是基于本帧最新的手部位姿，不会落后一帧
+ * - 写入目标前直接向 XR 追踪系统重新读取控制器位姿（与渲染线程 Late Update 同一数据源），
+ *   而不是用 MotionController 组件 Tick 时缓存的位姿
+ * - 外推时间取本帧物理步长（OnPhysScenePreTick 记录，含子步时为整帧步长）：
+ *   PhysicsHandle 每帧在游戏线程写入一次运动学目标，Chaos 在子步之间对运动学目标线性插值，
+ *   外推到步长末尾可以让每个子步都落在手部运动路径上。
+ *   这不是逐子步采样手部位姿；真正逐子步驱动需要启用异步物理 Tick 并在物理线程设置约束目标
+ * - 同时为每只手记录运动历史（FHandMotionHistory），手自身的 Tick 排在本驱动之后
+ * - 先采样所有手的位姿再统一写入，两只手（含双手抓同一物体）使用同一时刻的位姿
+ * - 手部目标按手部速度外推一段时间（GrabTargetPredictionScale），抵消 PhysicsHandle 的跟随延迟；
+ *   子步之间由物理求解器对运动学目标插值
+ * - 换手（HandleOtherHandHolding）过程中两只手指向同一组件/骨骼时只写入一次
+ * - 双手抓同一物理体时只有主手持有约束，目标由 FTwoHandGrabSolver 合成
+ */
+UCLASS()
+class VRTEST_API UGrabConstraintDriverSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的驱动，非游戏世界返回 nullptr */
+	static UGrabConstraintDriverSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** 注册手部（返回 false 表示驱动不可用，手应自行在 Tick 中更新目标） */
+	bool RegisterHand(UPlayerGrabHand* Hand);
+	void UnregisterHand(UPlayerGrabHand* Hand);
+
+	/** 手的 PhysicsHandle/父组件变化后重新建立 Tick 依赖 */
+	void RefreshHandPrerequisites(UPlayerGrabHand* Hand);
+
+	/** 由 Tick 函数调用：统一更新所有手的抓取目标 */
+	void UpdateGrabTargets(float DeltaTime);
+
+	/**
+	 * 直接从 XR 追踪系统读取手部父控制器的最新位姿并换算为手的世界位姿
+	 * @return 手不是挂在 MotionController 下或控制器未被追踪时返回 false
+	 */
+	static bool PollLatestHandTransform(const UPlayerGrabHand* Hand, FTransform& OutTransform);
+
+protected:
+	/** 物理场景开始步进前记录步长 */
+	void OnPhysScenePreTick(FPhysScene_Chaos* PhysScene, float DeltaTime);
+
+	struct FPendingGrabTarget
+	{
+		UPhysicsHandleComponent* PhysicsHandle = nullptr;
+		FVector Location = FVector::ZeroVector;
+		FRotator Rotation = FRotator::ZeroRotator;
+	};
+
+	FGrabConstraintDriverTickFunction DriverTickFunction;
+
+	TArray<TWeakObjectPtr<UPlayerGrabHand>> Hands;
+
+	/** 本帧待写入的目标（复用缓冲） */
+	TArray<FPendingGrabTarget> PendingTargets;
+
+	bool bTickRegistered = false;
+
+	/** 最近一次物理步进的步长（秒，0 表示还没有记录，使用帧间隔） */
+	float LastPhysicsStepTime = 0.0f;
+
+	FDelegateHandle PhysScenePreTickHandle;
+};
@@ -0,0 +1,84 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GrabHighlightSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 抓取高亮管理（World 级子系统）
+ *
+ * - 只有当前被高亮的 Primitive 才开启 Custom Depth，未高亮的物体不进入 Custom Depth Pass
+ * - 每个 Primitive 按请求者计数：同一物体被多个请求者高亮（如双手同时选中）时，
+ *   最后一个请求者撤销后才关闭
+ * - 状态变化先记录，每帧统一写入一次（同一帧内开了又关的请求不会触碰渲染状态）
+ * - 当前开启 Custom Depth 的数量见 stat VRTest
+ */
+UCLASS()
+class VRTEST_API UGrabHighlightSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的高亮管理，非游戏世界返回 nullptr */
+	static UGrabHighlightSubsystem* Get(const UObject* WorldContextObject);
+
+	/** 便捷入口：设置/撤销某个请求者对 Primitive 的高亮 */
+	static void SetHighlighted(UPrimitiveComponent* Primitive, const UObject* Requester, bool bHighlighted, int32 StencilValue = DefaultStencilValue);
+
+	/** 默认描边的 Stencil 值（与后处理材质约定） */
+	static constexpr int32 DefaultStencilValue = 4;
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	// ==================== 请求 ====================
+
+	/** 请求高亮（同一请求者重复请求只计一次） */
+	void AddHighlight(UPrimitiveComponent* Primitive, const UObject* Requester, int32 StencilValue = DefaultStencilValue);
+
+	/** 撤销高亮 */
+	void RemoveHighlight(UPrimitiveComponent* Primitive, const UObject* Requester);
+
+	/** 按请求者的 Key 撤销高亮（请求者可能已被销毁时使用） */
+	void RemoveHighlightByKey(UPrimitiveComponent* Primitive, const FObjectKey& RequesterKey);
+
+	/** 撤销某个请求者的全部高亮（请求者 EndPlay 时调用） */
+	void RemoveAllHighlights(const UObject* Requester);
+
+	/** 立即写入本帧累积的状态变化（通常由 Tick 调用） */
+	void FlushHighlights();
+
+	/** 当前开启 Custom Depth 的 Primitive 数量 */
+	UFUNCTION(BlueprintPure, Category = "Grab|Highlight")
+	int32 GetCustomDepthPrimitiveCount() const { return AppliedCount; }
+
+protected:
+	struct FHighlightEntry
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Primitive;
+
+		/** 当前请求者（一般只有 1~2 个） */
+		TArray<FObjectKey, TInlineAllocator<2>> Requesters;
+
+		int32 StencilValue = DefaultStencilValue;
+
+		/** 是否已写入渲染状态 */
+		bool bApplied = false;
+	};
+
+	TMap<FObjectKey, FHighlightEntry> Entries;
+
+	/** 本帧状态可能变化的 Primitive */
+	TSet<FObjectKey> DirtyPrimitives;
+
+	int32 AppliedCount = 0;
+};
@@ -38,5 +38,6 @@ enum class EArrowState : uint8
 	Idle,      // 闲置（可抓取）
 	Nocked,    // 搭在弓弦上
 	Flying,    // 飞行中
-	Stuck      // 插在目标上
+	Stuck,     // 插在目标上
+	Pooled     // 已回收到对象池（隐藏、无碰撞、不 Tick）
 };
@@ -0,0 +1,138 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Game/ActorSpatialIndex.h"
+#include "GrabbableRegistrySubsystem.generated.h"
+
+class UVRGrabHand;
+class UPlayerGrabHand;
+
+/**
+ * 一只手的目标查询参数
+ */
+struct FGrabbableQuery
+{
+	/** 锥形查询的起点（可以是外推后的手部位置） */
+	FVector Origin = FVector::ZeroVector;
+
+	/** 近距离查询的球心（当前手部位置，不外推，要和手的精确碰撞判断用同一个点） */
+	FVector NearOrigin = FVector::ZeroVector;
+
+	/** 锥形方向（单位向量） */
+	FVector Forward = FVector::ForwardVector;
+
+	/** 锥形（Gravity Gloves）查询距离 */
+	float ConeDistance = 0.0f;
+
+	/** 锥形半角的余弦（用点积比较，不做 Acos；半角需 <= 90 度） */
+	float ConeCosAngle = 1.0f;
+
+	/** 近距离（直接抓取）查询半径 */
+	float NearRadius = 0.0f;
+
+	/** 忽略的 Actor（通常是玩家自己） */
+	const AActor* IgnoreActor = nullptr;
+
+	/**
+	 * 发起查询的手：非空时在遍历中直接做 CanBeGrabbedBy（锥形另加 CanBeGrabbedByGravityGlove）判断，
+	 * 不能抓的物体不占候选名额，不会挡住后面可抓的目标
+	 */
+	const UPlayerGrabHand* Hand = nullptr;
+};
+
+/**
+ * 一只手的目标查询结果（几何筛选 + 查询指定了 Hand 时的接口判断）
+ */
+struct FGrabbableQueryResult
+{
+	/** 锥形内的候选（最多 8 个），按与手部朝向的夹角从小到大排序 */
+	TArray<AActor*, TInlineAllocator<8>> ConeCandidates;
+
+	/** 与 ConeCandidates 一一对应的夹角余弦（供选择打分/滞回使用） */
+	TArray<float, TInlineAllocator<8>> ConeCosAngles;
+
+	/** 包围球与近距离球相交的全部候选（不截断，手还要做精确的碰撞体距离判断），按距离从近到远排序 */
+	TArray<AActor*, TInlineAllocator<8>> NearCandidates;
+
+	void Reset()
+	{
+		ConeCandidates.Reset();
+		ConeCosAngles.Reset();
+		NearCandidates.Reset();
+	}
+};
+
+/**
+ * 可抓取物注册表（World 级子系统）
+ *
+ * - 实现 IGrabbable 的 Actor 在 BeginPlay 注册、EndPlay 注销（纯蓝图实现可调用 Register/Unregister）
+ * - 位置/包围半径取自 GetGrabPrimitive 的 Bounds，存放在 FActorSpatialIndex 的紧凑数组与松散网格中
+ * - 注册的 VR 手每帧只做一次查询：第一只手请求结果时，两只手的锥形/近距离查询在同一次遍历中完成
+ * - 锥形判定用点积阈值（cos²）代替 Acos，结果与场景物理复杂度无关
+ */
+UCLASS()
+class VRTEST_API UGrabbableRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的注册表，非游戏世界返回 nullptr */
+	static UGrabbableRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/** 注册/注销可抓取物（BeginPlay/EndPlay 调用的便捷入口） */
+	static void RegisterGrabbable(AActor* Actor);
+	static void UnregisterGrabbable(AActor* Actor);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// ==================== 注册 ====================
+
+	/** 注册可抓取物（需实现 IGrabbable） */
+	UFUNCTION(BlueprintCallable, Category = "Grab|Registry")
+	void Register(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Grab|Registry")
+	void Unregister(AActor* Actor);
+
+	/** 注册/注销参与批量查询的 VR 手 */
+	void RegisterHand(UVRGrabHand* Hand);
+	void UnregisterHand(UVRGrabHand* Hand);
+
+	UFUNCTION(BlueprintPure, Category = "Grab|Registry")
+	int32 GetRegisteredCount() const { return Index.Num(); }
+
+	/** 刷新后的空间索引（供 FShapeQuery 等通用查询使用） */
+	const FActorSpatialIndex& GetSpatialIndex();
+
+	// ==================== 查询 ====================
+
+	/**
+	 * 获取某只手本帧的查询结果
+	 * 本帧第一次调用时为所有注册的手一次性计算；未注册的手返回 nullptr
+	 */
+	const FGrabbableQueryResult* GetHandQueryResult(const UVRGrabHand* Hand);
+
+	/** 在一次遍历中执行多个查询（结果与 Queries 一一对应） */
+	void RunQueries(TArrayView<const FGrabbableQuery> Queries, TArray<FGrabbableQueryResult>& OutResults);
+
+protected:
+	/** 刷新空间索引（每帧最多一次） */
+	void RefreshIndex();
+
+	/** 为所有注册的手计算本帧结果 */
+	void UpdateHandQueries();
+
+	FActorSpatialIndex Index;
+
+	/** 注册的 VR 手及其本帧查询（下标一致） */
+	TArray<TWeakObjectPtr<UVRGrabHand>> Hands;
+	TArray<FGrabbableQuery> HandQueries;
+	TArray<FGrabbableQueryResult> HandResults;
+
+	uint64 LastRefreshFrame = MAX_uint64;
+	uint64 LastHandQueryFrame = MAX_uint64;
+};
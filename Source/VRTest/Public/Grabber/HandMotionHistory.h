@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 一帧手部位姿采样
+ */
+struct FHandMotionSample
+{
+	double Time = 0.0;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+
+	/** 采样时估计的线速度（最小二乘，平滑后） */
+	FVector Velocity = FVector::ZeroVector;
+};
+
+/**
+ * 手部运动历史（定长环形缓冲）
+ *
+ * - 每帧记录一次带时间戳的手部位姿，超出容量时覆盖最旧的采样
+ * - 线速度/加速度：对时间窗内的采样做二次多项式最小二乘拟合，取最新时刻的导数；
+ *   采样不足 3 个时退化为线性拟合。比逐帧差分抗抖动，且不依赖帧间隔均匀
+ * - 每个采样都保存当时的速度估计，供投掷类手势做峰值检测
+ * - 单帧位移超过 TeleportDistance 视为瞬移（传送/重生），清空历史
+ *
+ * 纯数据结构，由 UPlayerGrabHand 持有；投掷、定身球发射、Gravity Gloves 后拉共用。
+ */
+class VRTEST_API FHandMotionHistory
+{
+public:
+	static constexpr int32 Capacity = 32;
+
+	/** 单帧位移超过该值视为瞬移 */
+	static constexpr float TeleportDistance = 100.0f;
+
+	/**
+	 * 记录一帧采样（时间不晚于最新采样时忽略）
+	 * @param VelocityWindow 估计本采样速度所用的时间窗（秒）
+	 */
+	void AddSample(double Time, const FVector& Location, const FQuat& Rotation, float VelocityWindow);
+
+	void Reset();
+
+	int32 Num() const { return Count; }
+
+	/** 按新旧顺序取采样（0 = 最新） */
+	const FHandMotionSample& GetSample(int32 AgeIndex) const;
+
+	/**
+	 * 最小二乘估计最新时刻的线速度与加速度
+	 * @param Window 使用的时间窗（秒），至少使用最新的 2 个采样
+	 * @return 采样不足时返回 false（输出为零）
+	 */
+	bool EstimateMotion(float Window, FVector& OutVelocity, FVector& OutAcceleration) const;
+
+	/** 时间窗内的平均角速度（弧度/秒，方向为转轴） */
+	FVector EstimateAngularVelocity(float Window) const;
+
+	/**
+	 * 速度峰值检测：SinceTime 之后的采样中速度曾达到 MinPeakSpeed，且最新速度已回落到峰值的 DropRatio 以下
+	 * @param OutPeak 峰值采样
+	 */
+	bool FindSpeedPeak(double SinceTime, float MinPeakSpeed, float DropRatio, FHandMotionSample& OutPeak) const;
+
+private:
+	FHandMotionSample Samples[Capacity];
+
+	/** 最新采样的下标 */
+	int32 Head = INDEX_NONE;
+
+	int32 Count = 0;
+};
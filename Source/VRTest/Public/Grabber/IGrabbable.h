@@ -77,13 +77,15 @@ public:
 
 	/**
 	 * 当被选中时调用（Gravity Gloves 瞄准）
+	 * @param Hand 选中此物体的手（两只手可以同时选中同一物体）
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Grab")
-	void OnGrabSelected();
+	void OnGrabSelected(UPlayerGrabHand* Hand);
 
 	/**
 	 * 当取消选中时调用
+	 * @param Hand 取消选中的手（与 OnGrabSelected 时传入的一致）
 	 */
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Grab")
-	void OnGrabDeselected();
+	void OnGrabDeselected(UPlayerGrabHand* Hand);
 };
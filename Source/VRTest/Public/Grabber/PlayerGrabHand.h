@@ -6,6 +6,8 @@
 #include "Components/SceneComponent.h"
 #include "Components/SphereComponent.h"
 #include "Grabber/GrabTypes.h"
+#include "Grabber/HandMotionHistory.h"
+#include "Grabber/TwoHandGrabSolver.h"
 #include "PlayerGrabHand.generated.h"
 
 class IGrabbable;
@@ -18,6 +20,7 @@ class UAudioSubsystem;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnObjectGrabbed, AActor*, GrabbedActor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnObjectReleased, AActor*, ReleasedActor);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHandMotionSampled, UPlayerGrabHand* /*Hand*/);
 
 /**
  * 玩家手部组件基类
@@ -103,6 +106,27 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grab|Physics")
 	float WeaponSnapAngularDamping = 1000.0f;
 
+	/**
+	 * 抓取目标按手部速度外推的时间（以帧间隔为单位，0 = 不外推）
+	 * 用于抵消 PhysicsHandle 的跟随延迟
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grab|Physics", meta = (ClampMin = "0.0", ClampMax = "2.0"))
+	float GrabTargetPredictionScale = 0.5f;
+
+	/**
+	 * 双手抓住同一 Actor（Free/HumanBody）时由两只手合成目标：
+	 * 同一物理体只保留主手的一个约束；不同物理体（布娃娃的两根骨骼）各自保留约束，目标按质量加权统一求解
+	 * 关闭时两只手各自用 PhysicsHandle 拉扯
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grab|Physics")
+	bool bUseTwoHandSolver = true;
+
+	// ==================== 运动历史配置 ====================
+
+	/** 速度/加速度最小二乘拟合的时间窗（秒），越大越平滑、延迟越高 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grab|Motion", meta = (ClampMin = "0.01", ClampMax = "0.25"))
+	float MotionVelocityWindow = 0.05f;
+
 	// ==================== 状态 ====================
 	
 	/** 当前持有的 Actor */
@@ -130,6 +154,14 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Grab|State")
 	bool bGrabLocked = false;
 
+	/** 最近一次运动采样时的手部位置 */
+	UPROPERTY(BlueprintReadOnly, Category = "Grab|Motion")
+	FVector LastHandLocation = FVector::ZeroVector;
+
+	/** 当前手部速度（cm/s，由运动历史最小二乘估计） */
+	UPROPERTY(BlueprintReadOnly, Category = "Grab|Motion")
+	FVector HandVelocity = FVector::ZeroVector;
+
 	// ==================== 缓存组件 ====================
 
 	/** 缓存的 PhysicsHandleComponent（从 BasePlayer 获取，根据 bIsRightHand 选择） */
@@ -148,6 +180,9 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Grab|Events")
 	FOnObjectReleased OnObjectReleased;
 
+	/** 每次记录运动采样后广播（手势检测在此回调中进行，无需额外 Tick） */
+	FOnHandMotionSampled OnHandMotionSampled;
+
 	// ==================== 核心接口 ====================
 	
 	/**
@@ -197,6 +232,45 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Grab")
 	void SetGrabLock(bool bLock);
 
+	// ==================== 运动历史 ====================
+
+	/** 记录本帧手部位姿并更新速度估计（由 UGrabConstraintDriverSubsystem 每帧调用） */
+	void UpdateHandMotion(float DeltaTime);
+
+	/**
+	 * 设置写入抓取目标前重新读取的手部世界位姿（比组件 Tick 时的位姿更新）
+	 * 只在本帧有效，下一次 UpdateHandMotion 时清除
+	 */
+	void SetLatestHandTransform(const FTransform& InTransform);
+
+	const FHandMotionHistory& GetMotionHistory() const { return MotionHistory; }
+
+	/** 手部线速度（cm/s，最小二乘估计） */
+	UFUNCTION(BlueprintPure, Category = "Grab|Motion")
+	FVector GetHandVelocity() const { return HandVelocity; }
+
+	/** 手部线加速度（cm/s²） */
+	UFUNCTION(BlueprintPure, Category = "Grab|Motion")
+	FVector GetHandAcceleration() const { return HandAcceleration; }
+
+	/** 手部角速度（弧度/秒，方向为转轴） */
+	UFUNCTION(BlueprintPure, Category = "Grab|Motion")
+	FVector GetHandAngularVelocity() const { return HandAngularVelocity; }
+
+	// ==================== 抓取目标 ====================
+
+	/**
+	 * 计算 PhysicsHandle 目标（按手部速度外推后的位姿）
+	 * @return 当前未持有物体时返回 false
+	 */
+	bool ComputeGrabTarget(FVector& OutLocation, FRotator& OutRotation) const;
+
+	/** 是否是双手抓取中的副手（自身不持有约束） */
+	bool IsTwoHandSecondary() const { return bTwoHandSecondary; }
+
+	/** 双手抓取的另一只手（未配对时为 nullptr） */
+	UPlayerGrabHand* GetTwoHandPartner() const { return TwoHandPartner.Get(); }
+
 protected:
 	// ==================== 目标查找 ====================
 	
@@ -213,8 +287,56 @@ protected:
 	/** 释放 PhysicsHandle */
 	virtual void ReleasePhysicsHandle();
 
+	/** 配置 PhysicsHandle 强度并抓住 Primitive */
+	void BeginPhysicsGrab(UPrimitiveComponent* Primitive, FName BoneName, const FVector& GrabLocation, const FRotator& GrabRotation, bool bUseSnapStrength);
+
+	// ==================== 双手抓取 ====================
+
+	/**
+	 * 主手调用：副手加入，本手的约束改由两只手合成目标
+	 * 副手已用自己的约束抓住另一物理体时，副手约束的目标也由同一求解得出
+	 */
+	void BeginTwoHandGrab(UPlayerGrabHand* Secondary, float SecondaryWeight);
+
+	/** 解除配对（两只手都清理） */
+	void EndTwoHandGrab();
+
+	/** 副手在主手松开后接管：用自己的 PhysicsHandle 重新抓住 */
+	void RegrabWithOwnPhysicsHandle();
+
+	/** 按外推后的手部位姿 */
+	FTransform GetPredictedHandTransform() const;
+
+	/** 单手时的约束目标 */
+	bool ComputeSingleHandTarget(const FTransform& HandTransform, FVector& OutLocation, FRotator& OutRotation) const;
+
+	/** 抓住部位的质量（双手权重用） */
+	static float GetGrabbedBodyMass(UPrimitiveComponent* Primitive, FName BoneName);
+
 	// ==================== 辅助函数 ====================
 
+	/** 由 UGrabConstraintDriverSubsystem 统一更新抓取目标（false 时在自身 Tick 中更新） */
+	bool bGrabTargetDriven = false;
+
+	/** 手部运动历史及本帧估计结果（速度见 HandVelocity） */
+	FHandMotionHistory MotionHistory;
+	FVector HandAcceleration = FVector::ZeroVector;
+	FVector HandAngularVelocity = FVector::ZeroVector;
+
+	/** 抓取目标的外推时间（秒） */
+	float GrabPoseLeadTime = 0.0f;
+
+	/** 本帧重新读取的手部位姿（bHasLatestHandTransform 为 false 时使用组件位姿） */
+	FTransform LatestHandTransform;
+	bool bHasLatestHandTransform = false;
+
+	/** 双手抓取状态 */
+	TWeakObjectPtr<UPlayerGrabHand> TwoHandPartner;
+	bool bTwoHandSecondary = false;
+
+	/** 主手持有的双手求解器 */
+	FTwoHandGrabSolver TwoHandSolver;
+
 	/** 处理另一只手持有同一物体的情况 仅在处理非双手抓取的物体时调用 支持双手抓取的物体不调用*/
 	virtual void HandleOtherHandHolding(AActor* TargetActor, IGrabbable* Grabbable);
 };
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * 双手抓取位姿求解
+ *
+ * 双手抓住同一个物理体时只保留一个约束（主手的 PhysicsHandle），目标由两只手的位姿合成：
+ * - 配对时记录两只手在约束目标坐标系中的位置（相当于两个手柄刚性固定在物体上）
+ * - 旋转：先跟随主手的旋转变化，再把“主手→副手”轴摆正到当前两手连线方向
+ * - 位置：两个手柄各自要求的约束位置按权重（抓住部位的质量）加权平均，
+ *   抓住较重部位的手主导位置
+ * - 两只手抓住同一 Actor 的不同物理体（如布娃娃的两根骨骼）时两个约束都保留，
+ *   副手约束的目标 = 合成的主约束目标 * 配对时记录的相对变换，两个约束不再各拉各的
+ *
+ * 纯数学，不依赖 World，由 UPlayerGrabHand 持有。
+ */
+struct VRTEST_API FTwoHandGrabSolver
+{
+	/**
+	 * 配对时初始化
+	 * @param ConstraintTarget 当前约束目标（主手单手时的目标位姿）
+	 * @param PrimaryHand / SecondaryHand 两只手当前的位姿
+	 * @param PrimaryWeight / SecondaryWeight 权重（一般为各自抓住部位的质量）
+	 * @param SecondaryConstraintTarget 副手自己的约束目标（抓住另一物理体时传入，同一物理体时为空）
+	 */
+	void Initialize(const FTransform& ConstraintTarget, const FTransform& PrimaryHand, const FTransform& SecondaryHand,
+		float PrimaryWeight, float SecondaryWeight, const FTransform* SecondaryConstraintTarget = nullptr);
+
+	/** 由两只手当前的位姿求约束目标 */
+	void Solve(const FTransform& PrimaryHand, const FTransform& SecondaryHand, FVector& OutLocation, FQuat& OutRotation) const;
+
+	/** 副手是否有自己的约束（抓住的是另一物理体） */
+	bool HasSecondaryTarget() const { return bHasSecondaryTarget; }
+
+	/** 由合成的主约束目标求副手约束的目标 */
+	FTransform GetSecondaryTarget(const FVector& Location, const FQuat& Rotation) const;
+
+	bool IsValid() const { return bValid; }
+	void Reset() { bValid = false; }
+
+private:
+	/** 两只手在约束目标坐标系中的位置 */
+	FVector PrimaryLocal = FVector::ZeroVector;
+	FVector SecondaryLocal = FVector::ZeroVector;
+
+	/** 主手坐标系到约束目标旋转的相对旋转 */
+	FQuat PrimaryToTarget = FQuat::Identity;
+
+	/** 主手的归一化权重（副手为 1 - PrimaryAlpha） */
+	float PrimaryAlpha = 0.5f;
+
+	/** 两手距离过近时不做轴向校正 */
+	bool bHasAxis = false;
+
+	/** 副手约束目标相对主约束目标的变换 */
+	FTransform SecondaryTargetRelative = FTransform::Identity;
+	bool bHasSecondaryTarget = false;
+
+	bool bValid = false;
+};
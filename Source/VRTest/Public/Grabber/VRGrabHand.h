@@ -4,8 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "Grabber/PlayerGrabHand.h"
+#include "Game/VRBodyZone.h"
 #include "VRGrabHand.generated.h"
 
+struct FGrabbableQuery;
+class UGrabbableRegistrySubsystem;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBodyZoneChanged, EVRBodyZone, NewZone, EVRBodyZone, OldZone);
+
 /**
  * VR 模式手部组件
  * 
@@ -21,6 +27,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
@@ -54,6 +61,24 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|GravityGloves")
 	float LaunchArcParam = 0.5f;
 
+	// ==================== Gravity Gloves 选择（扫描频率/滞回） ====================
+
+	/** 目标扫描频率（次/秒），与帧率解耦；<= 0 表示每帧扫描 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|GravityGloves|Selection", meta=(ClampMin="0.0"))
+	float GravityGlovesScanRate = 30.0f;
+
+	/** 保持角度（度）：已选中的目标只要还在此角度内就不会因为离开锁定角而丢失，应大于 GravityGlovesAngle */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|GravityGloves|Selection", meta=(ClampMin="0.0", ClampMax="90.0"))
+	float GravityGlovesKeepAngle = 20.0f;
+
+	/** 切换余量：新候选的夹角余弦需比当前目标高出此值才考虑切换 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|GravityGloves|Selection", meta=(ClampMin="0.0"))
+	float GravityGlovesSwitchMargin = 0.005f;
+
+	/** 切换延迟（秒）：新候选需持续领先这么久才真正切换 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VR|GravityGloves|Selection", meta=(ClampMin="0.0"))
+	float GravityGlovesSwitchDelay = 0.1f;
+
 	// ==================== Gravity Gloves 状态 ====================
 	
 	/** 当前选中的远程目标（未抓取，仅瞄准） */
@@ -64,14 +89,6 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "VR|GravityGloves")
 	bool bIsVirtualGrabbing = false;
 
-	/** 上一帧手部位置（用于计算速度） */
-	UPROPERTY(BlueprintReadOnly, Category = "VR|GravityGloves")
-	FVector LastHandLocation;
-
-	/** 当前手部速度 */
-	UPROPERTY(BlueprintReadOnly, Category = "VR|GravityGloves")
-	FVector HandVelocity;
-
 	// ==================== 重写 ====================
 	
 	virtual void TryGrab(bool bFromBackpack = false) override;
@@ -79,9 +96,29 @@ public:
 
 	// ==================== VR 背包检测 ====================
 	
+	/** 手是否在可存取箭的区域（背包/箭袋）内，由 ABaseVRPlayer 每帧解析计算 */
 	UPROPERTY(BlueprintReadOnly, Category = "VR|Backpack")
 	bool bIsInBackpackArea = false;
 
+	/** 手当前所在的身体区域 */
+	UPROPERTY(BlueprintReadOnly, Category = "VR|Backpack")
+	EVRBodyZone CurrentBodyZone = EVRBodyZone::None;
+
+	/** 身体区域变化时广播 */
+	UPROPERTY(BlueprintAssignable, Category = "VR|Backpack")
+	FOnBodyZoneChanged OnBodyZoneChanged;
+
+	/**
+	 * 设置当前所在的身体区域
+	 * @return 区域是否发生变化
+	 */
+	bool SetBodyZone(EVRBodyZone NewZone);
+
+	// ==================== 可抓取物注册表 ====================
+
+	/** 本帧的目标查询参数（注册表批量查询两只手时调用） */
+	FGrabbableQuery BuildGrabbableQuery() const;
+
 protected:
 	// ==================== 目标查找 ====================
 	
@@ -91,8 +128,9 @@ protected:
 	
 	/**
 	 * 查找角度最近的可抓取物体（Gravity Gloves 用）
+	 * @param OutCosAngle 可选：输出目标夹角余弦
 	 */
-	AActor* FindAngleClosestTarget();
+	AActor* FindAngleClosestTarget(float* OutCosAngle = nullptr);
 
 	/**
 	 * 虚拟抓取（Gravity Gloves）
@@ -114,10 +152,7 @@ protected:
 	/** 更新 Gravity Gloves 逻辑 */
 	void UpdateGravityGloves(float DeltaTime);
 
-	/** 更新手部速度 */
-	void UpdateHandVelocity(float DeltaTime);
-
-	/** 检测向后拉动手势 */
+	/** 检测向后拉动手势（手部速度来自运动历史） */
 	bool CheckPullBackGesture() const;
 
 	/** 球形追踪（使用 Trace，用于 HumanBody 类型获取骨骼名）
@@ -128,4 +163,33 @@ protected:
 
 	/** 检查物体是否在 Gravity Gloves 角度范围内 */
 	bool IsInGravityGlovesAngle(AActor* Target) const;
+
+	// ==================== Gravity Gloves 选择（扫描频率/滞回） ====================
+
+	/** 本帧是否到了扫描时间（两只手按世界时间对齐，在同一帧扫描以便注册表批量查询） */
+	bool ShouldScanGravityGloves();
+
+	/** 带滞回的目标选择：当前目标在保持角内且新候选没有持续明显领先时，保持当前目标 */
+	AActor* SelectGravityGlovesTarget();
+
+	/** 切换选中目标（只在变化时调用 OnGrabSelected/OnGrabDeselected） */
+	void SetGravityGlovesTarget(AActor* NewTarget);
+
+	/** 目标相对手部朝向的夹角余弦（用抓取 Primitive 的包围盒中心，与注册表一致） */
+	float GetGravityGlovesAimCos(AActor* Target) const;
+
+	/** 当前目标是否仍可被 Gravity Gloves 选中 */
+	bool IsGravityGlovesTargetStillValid(AActor* Target) const;
+
+	/** 上一次扫描的世界时间桶（floor(Time * ScanRate)） */
+	int64 LastScanBucket = INDEX_NONE;
+
+	/** 等待切换的候选及其开始领先的时间 */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> PendingGravityGlovesTarget = nullptr;
+	float PendingGravityGlovesTargetTime = 0.0f;
+
+	/** 可抓取物注册表（BeginPlay 时缓存） */
+	UPROPERTY(Transient)
+	TObjectPtr<UGrabbableRegistrySubsystem> CachedGrabbableRegistry = nullptr;
 };
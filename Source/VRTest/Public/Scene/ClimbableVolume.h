@@ -11,6 +11,14 @@ class UBoxComponent;
 class UStaticMeshComponent;
 class UPlayerGrabHand;
 
+/**
+ * 可攀爬体积
+ *
+ * 编辑器中烘焙（BakeGripPoints）：在盒体内对静态几何做网格采样，得到抓点/边沿索引，
+ * 以盒体局部空间存放在紧凑数组中，随关卡保存。
+ * 运行时抓取只查询烘焙的抓点（FindNearestGripPoint），不做射线检测；
+ * 没有烘焙数据时保持旧行为（盒体内任意位置可抓）。
+ */
 UCLASS()
 class VRTEST_API AClimbableVolume : public AActor, public IGrabbable
 {
@@ -27,11 +35,51 @@ public:
 	virtual bool SupportsDualHandGrab_Implementation() const override;
 	virtual void OnGrabbed_Implementation(UPlayerGrabHand* Hand) override;
 	virtual void OnReleased_Implementation(UPlayerGrabHand* Hand) override;
-	virtual void OnGrabSelected_Implementation() override;
-	virtual void OnGrabDeselected_Implementation() override;
+	virtual void OnGrabSelected_Implementation(UPlayerGrabHand* Hand) override;
+	virtual void OnGrabDeselected_Implementation(UPlayerGrabHand* Hand) override;
+
+	// ==================== 抓点 ====================
+
+	/** 是否有烘焙的抓点 */
+	bool HasGripPoints() const { return GripLocalPositions.Num() > 0; }
+
+	int32 GetGripPointCount() const { return GripLocalPositions.Num(); }
+
+	float GetGripSnapDistance() const { return GripSnapDistance; }
+
+	/**
+	 * 查找最近的抓点（边沿按 LedgeDistanceScale 优先）
+	 * @param MaxDistance 最大吸附距离（世界空间）
+	 * @param OutLocation 抓点的世界位置
+	 * @param OutNormal 抓点表面的世界法线
+	 * @return MaxDistance 内没有抓点时返回 false
+	 */
+	bool FindNearestGripPoint(const FVector& WorldLocation, float MaxDistance, FVector& OutLocation, FVector& OutNormal, bool* bOutIsLedge = nullptr) const;
+
+	/**
+	 * 查找落脚的顶面高度：取水平距离最近、且低于查询点的顶面抓点
+	 * @param MaxHorizontalDistance 最大水平距离（世界空间）
+	 * @param MaxDrop 查询点之下的最大落差
+	 * @return 没有烘焙数据或范围内没有顶面抓点时返回 false
+	 */
+	bool FindLandingSurfaceZ(const FVector& WorldLocation, float MaxHorizontalDistance, float MaxDrop, float& OutZ) const;
+
+	/** 手抓取时用于查询抓点的位置（PC 用准星命中点，VR 用手的位置） */
+	FVector GetGripQueryLocation(const UPlayerGrabHand* Hand) const;
+
+#if WITH_EDITOR
+	/** 烘焙抓点：对盒体内的静态几何做网格采样 */
+	UFUNCTION(CallInEditor, Category = "Climb|Grip")
+	void BakeGripPoints();
+
+	/** 清除烘焙的抓点 */
+	UFUNCTION(CallInEditor, Category = "Climb|Grip")
+	void ClearGripPoints();
+#endif
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -39,5 +87,51 @@ protected:
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
 	UStaticMeshComponent* PreviewMesh = nullptr;
+
+	// ==================== 抓点配置 ====================
+
+	/** 烘焙采样间距（世界空间，cm） */
+	UPROPERTY(EditAnywhere, Category = "Climb|Grip", meta=(ClampMin="2.0"))
+	float GripSampleSpacing = 10.0f;
+
+	/** 表面法线 Z 不小于该值视为可站立的顶面，其余为墙面 */
+	UPROPERTY(EditAnywhere, Category = "Climb|Grip", meta=(ClampMin="0.0", ClampMax="1.0"))
+	float LedgeMinNormalZ = 0.7f;
+
+	/** 顶面相邻采样落差超过该值（或相邻无表面）视为边沿 */
+	UPROPERTY(EditAnywhere, Category = "Climb|Grip", meta=(ClampMin="1.0"))
+	float LedgeMinDrop = 20.0f;
+
+	/** 顶面抓点数量上限（边沿优先，超出时丢弃内部的顶面点） */
+	UPROPERTY(EditAnywhere, Category = "Climb|Grip", meta=(ClampMin="1"))
+	int32 MaxTopGripPoints = 1024;
+
+	/** 墙面抓点数量上限 */
+	UPROPERTY(EditAnywhere, Category = "Climb|Grip", meta=(ClampMin="1"))
+	int32 MaxWallGripPoints = 1024;
+
+	/** 抓取时吸附到抓点的最大距离 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|Grip", meta=(ClampMin="0.0"))
+	float GripSnapDistance = 25.0f;
+
+	/** 有烘焙数据时，只允许在抓点附近抓取 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|Grip")
+	bool bRequireGripPoint = true;
+
+	/** 边沿的距离系数（< 1 表示边沿更容易被选中） */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Climb|Grip", meta=(ClampMin="0.1", ClampMax="1.0"))
+	float LedgeDistanceScale = 0.75f;
+
+	// ==================== 烘焙数据（盒体局部空间，随关卡保存） ====================
+
+	UPROPERTY(VisibleAnywhere, Category = "Climb|Grip")
+	TArray<FVector3f> GripLocalPositions;
+
+	UPROPERTY()
+	TArray<FVector3f> GripLocalNormals;
+
+	/** 与 GripLocalPositions 一一对应：1 = 边沿 */
+	UPROPERTY()
+	TArray<uint8> GripIsLedge;
 };
 
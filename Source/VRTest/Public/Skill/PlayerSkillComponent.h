@@ -10,12 +10,14 @@
 class ABasePlayer;
 class AStarDrawManager;
 class ASkillStrategyBase;
+struct FStreamableHandle;
 
 /**
  * 玩家技能组件：
  * - 管理玩家技能学习状态
- * - 管理星图绘制状态与会话（Spawn/持有 StarDrawManager）
+ * - 管理星图绘制状态与会话（持有并复用 StarDrawManager）
  * - 作为技能触发入口（路由到策略）
+ * - 策略池：学会技能时异步加载策略的预加载资源，加载完成后预先生成策略实例，首次释放不再加载/生成
  */
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class VRTEST_API UPlayerSkillComponent : public UActorComponent
@@ -72,6 +74,16 @@ protected:
 
 	ASkillStrategyBase* GetStrategyForSkill(ESkillType SkillType) const;
 
+	/** 异步加载技能策略的预加载资源，完成后把策略实例放入池中（已在池中/加载中则忽略） */
+	void PreloadStrategy(ESkillType SkillType);
+
+	/** 预加载完成回调 */
+	void OnStrategyPreloaded(ESkillType SkillType);
+
+	/** 绘制进度回调：预测到唯一可能的已学技能时预热其策略 */
+	UFUNCTION()
+	void HandleStarDrawProgress(const TArray<ESkillType>& CandidateSkills, ESkillType PredictedSkill, ESkillType CompletedSkill);
+
 protected:
 	// ==================== 学习状态 ====================
 
@@ -87,9 +99,13 @@ protected:
 	UPROPERTY(Transient)
 	TMap<ESkillType, TSubclassOf<ASkillStrategyBase>> StrategyClassMap;
 
+	/** 策略实例池：每种技能一个实例，学会技能时预先生成，反复释放复用 */
 	UPROPERTY(Transient)
 	mutable TMap<ESkillType, TObjectPtr<ASkillStrategyBase>> StrategyInstanceCache;
 
+	/** 预加载句柄：加载中可取消，加载完成后持有以保证资源常驻 */
+	TMap<ESkillType, TSharedPtr<FStreamableHandle>> StrategyPreloadHandles;
+
 	/** 缓存的 Owner（BasePlayer）。BeginPlay 中初始化。 */
 	UPROPERTY(Transient)
 	TObjectPtr<ABasePlayer> CachedOwnerPlayer;
@@ -106,6 +122,10 @@ protected:
 	UPROPERTY(Transient)
 	FSkillContext CachedDrawContext;
 
+	/** 本次绘制已预热的技能（同一技能每次绘制只预热一次） */
+	UPROPERTY(Transient)
+	ESkillType PreparedSkill = ESkillType::None;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Skill|State")
 	TObjectPtr<AStarDrawManager> StarDrawManager;
 	
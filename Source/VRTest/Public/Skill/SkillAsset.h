@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Engine/DataAsset.h"
 #include "Skill/SkillTypes.h"
+#include "Skill/StarDrawTrailTrie.h"
 #include "SkillAsset.generated.h"
 
 class UNiagaraSystem;
@@ -16,8 +17,8 @@ class ASkillStrategyBase;
 /**
  * SkillAsset：技能系统的统一配置资产。
  *
- * - StarDraw 识别层：轨迹序列字符串 -> 技能类型
- * - StarDraw 表现层：FingerPoint/MainStar/OtherStar 的蓝图类
+ * - StarDraw 识别层：轨迹方向序列 -> 技能类型（编译为前缀树，绘制时逐步推进）
+ * - StarDraw 表现层：FingerPoint/MainStar/OtherStar 的蓝图类（只读取其 Mesh 组件作为网格模板，运行时不生成 Actor）
  */
 UCLASS(BlueprintType)
 class VRTEST_API USkillAsset : public UDataAsset
@@ -31,17 +32,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw")
 	TArray<FStarDrawTrailPair> StarDrawTrailPairs;
 
-	/**
-	 * 运行时缓存：轨迹序列字符串 -> 技能类型。例："0247" -> EagleEye。
-	 * 不对蓝图/编辑器开放配置，由 StarDrawTrailPairs 预处理生成。
-	 */
-	UPROPERTY(Transient)
-	TMap<FString, ESkillType> TrailToSkill;
-
 	/** 按方向序列查询对应技能；非法/找不到返回 None。 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill|StarDraw")
 	ESkillType GetSkillTypeFromTrail(const TArray<EStarDrawDirection>& Trail) const;
 
+	/** 轨迹前缀树（含反向轨迹），供 StarDrawManager 在绘制过程中逐步推进 */
+	const FStarDrawTrailTrie& GetTrailTrie() const { return TrailTrie; }
+
 	// ==================== 表现配置 ====================
 
 	/** FingerPoint 蓝图类（用于自定义模型/特效）。 */
@@ -78,5 +75,10 @@ protected:
 
 private:
 	void RebuildTrailToSkillCache();
-	FString BuildTrailKey(const TArray<EStarDrawDirection>& Trail) const;
+
+	/**
+	 * 运行时缓存：由 StarDrawTrailPairs 预处理生成的前缀树。
+	 * 不对蓝图/编辑器开放配置。
+	 */
+	FStarDrawTrailTrie TrailTrie;
 };
@@ -13,6 +13,7 @@ class ABasePlayer;
  * 技能策略基类：每个具体技能实现一个策略 Actor。
  *
  * 框架约束：策略只关心“如何执行技能”，不处理技能学习状态，也不管理绘制会话生命周期。
+ * 生命周期：玩家学会技能时由 PlayerSkillComponent 异步加载 PreloadAssets，加载完成后预先生成策略实例并复用。
  */
 UCLASS(Abstract, Blueprintable)
 class VRTEST_API ASkillStrategyBase : public AActor
@@ -29,4 +30,23 @@ public:
 	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Skill")
 	bool Execute(ABasePlayer* Player, const FSkillContext& Context);
 	virtual bool Execute_Implementation(ABasePlayer* Player, const FSkillContext& Context) { return false; }
+
+	/**
+	 * 预热：绘制过程中轨迹只剩本技能一个可能时调用（可能不会紧接着 Execute，例如玩家中途放弃）。
+	 * 子类可在此提前加载/准备释放所需的资源，避免释放瞬间卡顿。默认不做任何事。
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Skill")
+	void PrepareCast(ABasePlayer* Player, const FSkillContext& Context);
+	virtual void PrepareCast_Implementation(ABasePlayer* Player, const FSkillContext& Context) {}
+
+	/**
+	 * 收集学会技能时需要异步预加载的资源（读取 CDO，不需要实例）。
+	 * 默认返回 PreloadAssets；子类可追加自己的软引用。
+	 */
+	virtual void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
+protected:
+	/** 释放时才会用到的软引用资源（特效/音效/类等），学会技能时异步加载并常驻 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Skill|Preload")
+	TArray<TSoftObjectPtr<UObject>> PreloadAssets;
 };
@@ -44,7 +44,7 @@ struct FSkillContext
 
 /**
  * StarDraw 轨迹到技能的配置项（用于蓝图直观配置）。
- * 运行时会预处理成字符串 Key（例如 "0247"）以便快速查找。
+ * 运行时会预处理成前缀树（FStarDrawTrailTrie），绘制时每触碰一颗星前进一步。
  */
 USTRUCT(BlueprintType)
 struct FStarDrawTrailPair
@@ -8,17 +8,12 @@
 
 class USphereComponent;
 class UStaticMeshComponent;
-class AStarDrawManager;
 
 /**
  * FingerPoint：玩家“指向/手/相机输入源”投射到圆柱面上的当前位置。
  *
- * 蓝图里：
- * - 使用 SphereCollision 进行 overlap（OtherStars）
- * - Tick 中 SphereTraceSingleForObjects 检测触碰 OtherStars
- *
- * C++ 里：
- * - 主要用于携带碰撞体，触发与 OtherStars 的重叠回调
+ * 只作为表现模板：AStarDrawManager 读取其 CDO 上 Mesh 的网格/材质/相对变换，运行时不生成该 Actor。
+ * 触碰判定由 FStarDrawSession 按几何距离完成，SphereCollision 不参与碰撞（保留以兼容已有蓝图）。
  */
 UCLASS(Blueprintable)
 class VRTEST_API AStarDrawFingerPoint : public AActor
@@ -28,25 +23,11 @@ class VRTEST_API AStarDrawFingerPoint : public AActor
 public:
 	AStarDrawFingerPoint();
 
-	void SetDrawManager(AStarDrawManager* InManager) { DrawManager = InManager; }
-
-protected:
-	virtual void BeginPlay() override;
-
-	UFUNCTION()
-	void OnFingerOverlapBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
-		UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep, const FHitResult& SweepResult);
-
-public:
-	/** Root：SphereCollision（可在蓝图中调半径/碰撞） */
+	/** Root：SphereCollision（无碰撞，仅保留组件结构） */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw")
 	USphereComponent* SphereCollision = nullptr;
 
 	/** 可视化 Mesh（蓝图子类可设置具体网格体） */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw")
 	UStaticMeshComponent* Mesh = nullptr;
-
-protected:
-	UPROPERTY()
-	TObjectPtr<AStarDrawManager> DrawManager;
 };
@@ -5,20 +5,36 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Skill/SkillTypes.h"
+#include "Skill/StarDrawSession.h"
 #include "StarDrawManager.generated.h"
 
 class UNiagaraComponent;
-class AStarDrawFingerPoint;
-class AStarDrawMainStar;
+class UStaticMeshComponent;
+class UInstancedStaticMeshComponent;
 class AStarDrawOtherStar;
 class USkillAsset;
 class UAudioSubsystem;
 
+/**
+ * 绘制进度：每确认一颗星（以及开始绘制时）广播一次
+ * @param CandidateSkills 继续绘制仍可能达成的技能
+ * @param PredictedSkill 只剩一个可能的技能时为该技能，否则为 None
+ * @param CompletedSkill 当前轨迹正好对应的技能（此时松手即释放），否则为 None
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnStarDrawProgress, const TArray<ESkillType>&, CandidateSkills, ESkillType, PredictedSkill, ESkillType, CompletedSkill);
+
 /**
  * 星图绘制管理器（Actor）。
  *
  * 职责：管理星图绘制的生命周期，并在结束时输出识别到的技能类型。
  * 说明：本类只负责绘制/识别，不负责判断技能是否已学习，也不直接触发技能效果。
+ *
+ * - 绘制逻辑全部在 FStarDrawSession（纯数据）中完成：手指投影到圆柱面后与候选点比较平方距离，
+ *   绘制过程中没有任何碰撞/重叠更新
+ * - 表现：MainStar/OtherStar 各用一个实例化网格，FingerPoint 用一个网格组件，
+ *   网格/材质/相对变换取自 SkillAsset 中配置的蓝图类（只读其 CDO，不生成 Actor）
+ * - Manager 由 PlayerSkillComponent 持有并复用：开始/结束一次绘制不会生成或销毁任何 Actor
+ * - 识别：沿 SkillAsset 的轨迹前缀树逐步推进，绘制过程中即可得到候选技能（OnStarDrawProgress）
  */
 UCLASS(Blueprintable)
 class VRTEST_API AStarDrawManager : public AActor
@@ -27,13 +43,25 @@ class VRTEST_API AStarDrawManager : public AActor
 
 public:
 	AStarDrawManager();
-	
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UNiagaraComponent* DrawLineEffect;
-	
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	UNiagaraComponent* FingerPointEffect;
-	
+
+	/** 已确认的星（实例化网格） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw|Visual")
+	UInstancedStaticMeshComponent* MainStarInstances;
+
+	/** 候选星（实例化网格） */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw|Visual")
+	UInstancedStaticMeshComponent* OtherStarInstances;
+
+	/** 手指位置 */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw|Visual")
+	UStaticMeshComponent* FingerPointMesh;
+
 	/** 开始绘制。InputSource：PC=Camera，VR=Hand。 */
 	UFUNCTION(BlueprintCallable, Category = "Skill|StarDraw")
 	virtual void StartDraw(USceneComponent* InInputSource);
@@ -43,21 +71,25 @@ public:
 	virtual ESkillType FinishDraw();
 
 	/**
-	 * 统一清理接口：清理 Main/Other stars、清空 VFX（Niagara components），并自我销毁。
+	 * 清理本次绘制的表现（隐藏星、停用 VFX、停止 Tick），Manager 保留复用。
 	 * 玩家层（例如 PlayerSkillComponent）在调用 FinishDraw 获取结果后应调用此函数来完成收尾工作。
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Skill|StarDraw")
+	void ResetDraw();
+
+	/** 清理并销毁 Manager（所属玩家 EndPlay 时调用） */
+	UFUNCTION(BlueprintCallable, Category = "Skill|StarDraw")
 	void CleanupAndDestroy();
 
 	UFUNCTION(BlueprintCallable, BlueprintPure, Category = "Skill|StarDraw")
 	bool IsDrawing() const { return bIsDrawing; }
 
-	/**
-	 * 由 FingerPoint 回调：当 FingerPoint 触碰到某个 Actor（通常是 OtherStar）时通知 DrawManager。
-	 *
-	 * 说明：这里不直接依赖碰撞通道/Trace，以便 VR/PC 使用同一套回调机制。
-	 */
-	void NotifyFingerTouchActor(AActor* TouchedActor);
+	/** 当前绘制状态（只读） */
+	const FStarDrawSession& GetSession() const { return Session; }
+
+	/** 绘制进度（UI 提示、技能预热） */
+	UPROPERTY(BlueprintAssignable, Category = "Skill|StarDraw")
+	FOnStarDrawProgress OnStarDrawProgress;
 
 protected:
 	virtual void BeginPlay() override;
@@ -66,34 +98,32 @@ protected:
 	UPROPERTY(Transient)
 	TObjectPtr<UAudioSubsystem> CachedAudioSubsystem = nullptr;
 
-	void FirstTouch();
-	void TouchOtherStar(AStarDrawOtherStar* OtherStar);
+	/** 确认一个候选方向（记录轨迹、刷新星的表现、播放音效） */
+	void TouchCandidate(EStarDrawDirection Direction);
 
-	void SpawnFingerPoint();
-	void SpawnMainStarAt(const FVector& Location);
-	void SpawnOtherStarsAround(const FVector& CenterLocation);
-	void ClearOtherStars();
-	void ClearMainStars();
+	/** 广播当前识别进度 */
+	void BroadcastProgress();
 
 	FVector GetPlayerPivotLocation() const;
 	FVector GetInputSourceLocation() const;
 	FVector GetInputSourceForwardVector() const;
 
 	void UpdateFingerPointLocation(float DeltaSeconds);
-	void UpdateVFX();
 
 	/**
-	 * 计算“圆柱面上的邻接点”——替代旧蓝图函数库。
-	 *
-	 * 设计：以 PlayerPivot 为圆柱轴心，半径为 Radius，围绕 CenterLocation 生成 8 个邻接点。
-	 * - 左/右：绕 Z 轴旋转
-	 * - 上/下：沿 Z 轴移动
-	 * - 左上/右上/左下/右下：组合
+	 * 把点数据推给 Niagara 数组参数。
+	 * 星的集合变化（bVFXPointsDirty）时整体重写 DrawLine 数组；否则只原地更新变化了的末端点，
+	 * 位置没变时什么都不做（不标脏数据接口）。
 	 */
-	TMap<EStarDrawDirection, FVector> CalculateAdjacentPointsOnCylinder(const FVector& PlayerPivot, const FVector& CenterLocation, float InLineLength) const;
+	void UpdateVFX();
 
-	float CalculateRadiusOnXY(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float Distance) const;
-	FVector CalculateProjectionPointOnCylinder(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float Radius) const;
+	// ==================== 表现 ====================
+
+	/** 从 SkillAsset 配置的蓝图类读取网格/材质/相对变换 */
+	void ApplyVisualTemplates();
+
+	/** 星的集合变化后重建实例（只在确认新星时调用） */
+	void RefreshStarInstances();
 
 	virtual ESkillType ResolveSkillFromDraw() const;
 
@@ -116,38 +146,32 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw|Config")
 	float LineLength =20.f;
 
-	UPROPERTY(BlueprintReadOnly, Category = "Skill|StarDraw|State")
-	float Radius = 0.f;
-
-	/** 玩家轴心位置（旧蓝图 TriggerCameraLocation） */
-	UPROPERTY(BlueprintReadOnly, Category = "Skill|StarDraw|State")
-	FVector PlayerPivotLocation = FVector::ZeroVector;
-
-	UPROPERTY(BlueprintReadOnly, Category = "Skill|StarDraw|State")
-	FVector FingerPointLocation = FVector::ZeroVector;
-
-	/** 轨迹方向数组（旧蓝图 DirectionChoose） */
-	UPROPERTY(BlueprintReadOnly, Category = "Skill|StarDraw|State")
-	TArray<EStarDrawDirection> DirectionChoose;
+	/** 手指触碰候选星的距离（原 FingerPoint 球半径 4 + OtherStar 球半径 2） */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw|Config", meta=(ClampMin="0.0"))
+	float StarTouchRadius = 6.f;
 
+	/** 隐藏走不通的候选星（前缀树上没有以该方向继续的轨迹），隐藏的星也不可触碰 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skill|StarDraw|Config")
+	bool bHideDeadStars = true;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Skill|StarDraw|Spawn")
-	TSubclassOf<AStarDrawFingerPoint> FingerPointClass;
+	/** 本次绘制的状态 */
+	FStarDrawSession Session;
 
-	UPROPERTY(EditDefaultsOnly, Category = "Skill|StarDraw|Spawn")
-	TSubclassOf<AStarDrawMainStar> MainStarClass;
+	// ==================== VFX 缓冲 ====================
 
-	UPROPERTY(EditDefaultsOnly, Category = "Skill|StarDraw|Spawn")
-	TSubclassOf<AStarDrawOtherStar> OtherStarClass;
+	/** DrawLine 的点：MainStars + 手指（末尾），跨绘制复用，只在星增加时追加 */
+	TArray<FVector> DrawLinePoints;
 
-	UPROPERTY(Transient)
-	TObjectPtr<AStarDrawFingerPoint> FingerPoint;
+	/** 上次推给 FingerPointEffect 的两端点：[0]=手指，[1]=输入源（BeginPlay 中定长为 2） */
+	TArray<FVector> FingerLinePoints;
 
-	UPROPERTY(Transient)
-	TArray<TObjectPtr<AStarDrawMainStar>> MainStars;
+	/** 星的集合变化后置位：下次 UpdateVFX 整体重写 DrawLine 数组 */
+	bool bVFXPointsDirty = true;
 
-	UPROPERTY(Transient)
-	TArray<TObjectPtr<AStarDrawOtherStar>> OtherStars;
+	/** 各类星的网格相对变换（取自蓝图类中 Mesh 组件的相对变换） */
+	FTransform MainStarVisualTransform = FTransform::Identity;
+	FTransform OtherStarVisualTransform = FTransform::Identity;
+	FTransform FingerPointVisualTransform = FTransform::Identity;
 
 	/** 缓存：技能总资产（BeginPlay 从 GameSettings 加载一次） */
 	UPROPERTY(Transient)
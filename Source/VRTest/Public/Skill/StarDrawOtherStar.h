@@ -12,7 +12,9 @@ class USphereComponent;
 class UStaticMeshComponent;
 
 /**
- * OtherStar：围绕某个 MainStar 生成的 8 个候选点。
+ * OtherStar：围绕某个 MainStar 的 8 个候选点。
+ * 只作为表现模板：AStarDrawManager 读取其 CDO 上 Mesh 的网格/材质/相对变换，运行时不生成该 Actor，
+ * 触碰判定由 FStarDrawSession 按几何距离完成。
  * 约定：Actor Tag 使用 lower_snake_case（other_stars）。
  */
 UCLASS(Blueprintable)
@@ -30,7 +32,7 @@ public:
 	EStarDrawDirection GetDirection() const { return Direction; }
 
 public:
-	/** Root：SphereCollision */
+	/** Root：SphereCollision（无碰撞，仅保留组件结构） */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="Skill|StarDraw")
 	USphereComponent* SphereCollision = nullptr;
 
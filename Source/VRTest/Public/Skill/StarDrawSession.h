@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skill/StarDrawDirection.h"
+#include "Skill/SkillTypes.h"
+
+struct FStarDrawTrailTrie;
+
+/**
+ * 一次星图绘制的状态（纯数据，不依赖 Actor/World）。
+ *
+ * - 以玩家轴心为轴的圆柱面：手指位置 = 输入源射线与圆柱面的交点
+ * - MainStars：已确认的星（轨迹经过的点）
+ * - Candidates：围绕最后一颗 MainStar 的 8 个候选点（下标即 EStarDrawDirection），
+ *   上一步的反方向不作为候选
+ * - 触碰判定：手指移动线段与候选点的平方距离，不依赖碰撞/重叠
+ * - 轨迹前缀树（可选）：每确认一颗星前进一个节点，实时得到可能的技能；
+ *   走不通的候选点可直接剔除（既不显示也不可触碰）
+ *
+ * 由 AStarDrawManager 持有，表现层只读取这里的数据。
+ */
+struct VRTEST_API FStarDrawSession
+{
+	static constexpr int32 NumDirections = 8;
+
+	/**
+	 * 开始绘制：第一颗星落在 ControllerLocation + Forward * Distance
+	 * @param InLineLength 相邻星之间的距离
+	 * @param InTrie 轨迹前缀树（为空时不做识别与剔除），生命周期须覆盖本次绘制
+	 * @param bInPruneDeadCandidates 是否剔除前缀树上走不通的候选点
+	 */
+	void Begin(const FVector& InPivot, const FVector& ControllerLocation, const FVector& Forward, float Distance, float InLineLength,
+		const FStarDrawTrailTrie* InTrie = nullptr, bool bInPruneDeadCandidates = false);
+
+	void Reset();
+
+	/** 更新手指位置（投影到圆柱面） */
+	void UpdateFinger(const FVector& ControllerLocation, const FVector& Forward);
+
+	/**
+	 * 查找手指本帧触碰的候选点
+	 *
+	 * 按手指本帧移动的线段（上一帧位置 -> 当前位置）与各候选点的平方距离判定，
+	 * 快速划过时不会漏掉；同时触碰多个时取线段上最先经过的那个。
+	 * @return 是否触碰到
+	 */
+	bool FindTouchedCandidate(float TouchRadius, EStarDrawDirection& OutDirection) const;
+
+	/**
+	 * 确认某个方向的候选点为新的 MainStar，并重新生成候选点
+	 * @return 是否确认成功（候选点不存在、或为上一步的反方向时返回 false）
+	 */
+	bool ConfirmCandidate(EStarDrawDirection Direction);
+
+	bool IsActive() const { return bActive; }
+
+	const FVector& GetPivot() const { return Pivot; }
+	float GetRadius() const { return Radius; }
+	const FVector& GetFingerLocation() const { return FingerLocation; }
+
+	const TArray<FVector>& GetMainStars() const { return MainStars; }
+	const TArray<EStarDrawDirection>& GetTrail() const { return Trail; }
+
+	/** 候选点是否有效（已生成且不是上一步的反方向） */
+	bool IsCandidateActive(EStarDrawDirection Direction) const { return (CandidateMask & (1u << StarDrawDirectionToInt(Direction))) != 0; }
+	const FVector& GetCandidate(EStarDrawDirection Direction) const { return Candidates[StarDrawDirectionToInt(Direction)]; }
+
+	/** 候选点掩码（第 i 位对应 EStarDrawDirection i） */
+	uint8 GetCandidateMask() const { return CandidateMask; }
+
+	// ==================== 识别进度 ====================
+
+	/** 当前轨迹在前缀树上的节点；没有前缀树或轨迹已走出前缀树时为 INDEX_NONE */
+	int32 GetTrieNode() const { return TrieNode; }
+
+	/** 候选点中还能走向某个技能的部分（没有前缀树时等于 GetCandidateMask） */
+	uint8 GetLiveCandidateMask() const;
+
+	/** 当前轨迹正好对应的技能（None 表示还不是完整轨迹） */
+	ESkillType GetCompletedSkill() const;
+
+	/** 继续绘制仍可能达成的技能掩码（第 i 位对应 ESkillType i） */
+	uint32 GetReachableSkillMask() const;
+
+	/** 仍可能达成的技能只剩一个时返回它，否则返回 None */
+	ESkillType GetPredictedSkill() const;
+
+	// ==================== 圆柱面几何 ====================
+
+	/** 水平半径：Controller 沿 Forward 前进 Distance 后到轴心的水平距离 */
+	static float CalculateRadiusOnXY(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float Distance);
+
+	/** 射线与圆柱面（绕世界 Z 轴）的最近前向交点；无交点时返回 ControllerLocation */
+	static FVector ProjectOntoCylinder(const FVector& PlayerPivot, const FVector& ControllerLocation, const FVector& Forward, float Radius);
+
+	/**
+	 * 圆柱面上围绕 CenterLocation 的 8 个邻接点（下标即 EStarDrawDirection）
+	 * - 左/右：绕 Z 轴旋转（弦长为 LineLength）
+	 * - 上/下：沿 Z 轴移动
+	 * - 左上/右上/左下/右下：组合
+	 * @return 中心在轴上（半径为 0）时返回 false
+	 */
+	static bool CalculateAdjacentPoints(const FVector& PlayerPivot, const FVector& CenterLocation, float LineLength, FVector (&OutPoints)[NumDirections]);
+
+private:
+	/** 新增一颗 MainStar 并围绕它生成候选点 */
+	void AddMainStar(const FVector& Location);
+
+	FVector Pivot = FVector::ZeroVector;
+	float Radius = 0.0f;
+	float LineLength = 0.0f;
+	FVector FingerLocation = FVector::ZeroVector;
+
+	/** 上一帧的手指位置（扫掠判定的起点） */
+	FVector PrevFingerLocation = FVector::ZeroVector;
+
+	TArray<FVector> MainStars;
+	TArray<EStarDrawDirection> Trail;
+
+	FVector Candidates[NumDirections];
+	uint8 CandidateMask = 0;
+
+	const FStarDrawTrailTrie* Trie = nullptr;
+	int32 TrieNode = INDEX_NONE;
+	bool bPruneDeadCandidates = false;
+
+	bool bActive = false;
+};
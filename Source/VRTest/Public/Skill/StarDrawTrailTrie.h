@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Skill/SkillTypes.h"
+
+/**
+ * 星图轨迹前缀树（纯数据）。
+ *
+ * 由 USkillAsset 根据 StarDrawTrailPairs（含反向轨迹）编译生成：
+ * - 绘制时每确认一颗星前进一个节点，不再在结束时拼接字符串查表
+ * - 每个节点记录可继续的方向（用于隐藏走不通的候选星）和从该节点仍可达成的技能集合（用于提前预测技能）
+ */
+struct VRTEST_API FStarDrawTrailTrie
+{
+	static constexpr int32 RootNode = 0;
+
+	FStarDrawTrailTrie() { Reset(); }
+
+	/** 清空，只保留根节点 */
+	void Reset();
+
+	/**
+	 * 加入一条轨迹
+	 * @param OutReplaced 输出被覆盖的旧技能（该轨迹此前未配置时为 None）
+	 * @return 是否加入（空轨迹返回 false）
+	 */
+	bool Add(TConstArrayView<EStarDrawDirection> Trail, ESkillType Skill, ESkillType& OutReplaced);
+
+	/** 从 Node 沿 Direction 前进；走不通返回 INDEX_NONE */
+	int32 Advance(int32 Node, EStarDrawDirection Direction) const;
+
+	/** 完整查询一条轨迹；不存在返回 None */
+	ESkillType Find(TConstArrayView<EStarDrawDirection> Trail) const;
+
+	/** Node 处正好结束的轨迹对应的技能（不是终点时为 None） */
+	ESkillType GetSkill(int32 Node) const;
+
+	/** Node 处可继续前进的方向掩码（第 i 位对应 EStarDrawDirection i） */
+	uint8 GetNextDirectionMask(int32 Node) const;
+
+	/** 从 Node 出发（含 Node 本身）仍可达成的技能掩码（第 i 位对应 ESkillType i） */
+	uint32 GetReachableSkillMask(int32 Node) const;
+
+	/** 从 Node 出发仍可达成的技能只剩一个时返回它，否则返回 None */
+	ESkillType GetPredictedSkill(int32 Node) const;
+
+	/** 把技能掩码展开成数组 */
+	static void SkillMaskToArray(uint32 SkillMask, TArray<ESkillType>& OutSkills);
+
+	bool IsValidNode(int32 Node) const { return Nodes.IsValidIndex(Node); }
+	int32 GetNodeCount() const { return Nodes.Num(); }
+
+private:
+	struct FNode
+	{
+		int32 Children[8];
+		uint8 ChildMask = 0;
+		ESkillType Skill = ESkillType::None;
+		uint32 ReachableSkills = 0;
+
+		FNode()
+		{
+			for (int32& Child : Children)
+			{
+				Child = INDEX_NONE;
+			}
+		}
+	};
+
+	/** 重新计算所有节点的 ReachableSkills（覆盖已有轨迹时旧技能可能不再可达） */
+	void RebuildReachableSkills();
+
+	TArray<FNode> Nodes;
+};
@@ -6,6 +6,11 @@
 #include "GameFramework/Actor.h"
 #include "FakePhysicsHandleActor.generated.h"
 
+/**
+ * 弹簧追踪的 Actor：朝 TargetLocation（或 GetTrackedComponent 返回的组件）做弹簧运动
+ *
+ * 自身不 Tick：StartSimulate 后由 UFakePhysicsSubsystem 与其他条目一起按固定步长批量积分
+ */
 UCLASS()
 class VRTEST_API AFakePhysicsHandleActor : public AActor
 {
@@ -18,11 +23,9 @@ public:
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
-	// Called every frame
-	virtual void Tick(float DeltaTime) override;
-
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "FakePhysicsHandle")
 	float SpringForceMin = 0.1f;
 
@@ -45,21 +48,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "FakePhysicsHandle")
 	void SetTargetLocation(const FVector& NewTargetLocation);
 
+	/** 设置速度；未模拟时先记下，StartSimulate 时作为初速度 */
 	UFUNCTION(BlueprintCallable, Category = "FakePhysicsHandle")
-	void SetCurrentVelocity(const FVector& NewVelocity)
-	{
-		CurrentVelocity = NewVelocity;
-	}
+	void SetCurrentVelocity(const FVector& NewVelocity);
+
+	/** 当前速度（未模拟时为待生效的初速度） */
+	UFUNCTION(BlueprintPure, Category = "FakePhysicsHandle")
+	FVector GetCurrentVelocity() const;
 
+	/** 从当前位置开始模拟，初速度为之前 SetCurrentVelocity 设置的值（默认零） */
 	UFUNCTION(BlueprintCallable, Category = "FakePhysicsHandle")
 	void StartSimulate();
 	
+	/** 停止模拟，速度清零 */
 	UFUNCTION(BlueprintCallable, Category = "FakePhysicsHandle")
 	void StopSimulate();
 
-private:
-	// 当前速度
-	FVector CurrentVelocity = FVector::ZeroVector;
+	UFUNCTION(BlueprintPure, Category = "FakePhysicsHandle")
+	bool IsSimulating() const { return Simulating; }
 
+	/** 追踪的组件：非空时每帧以它的位置代替 TargetLocation（批量积分读取前调用） */
+	virtual const USceneComponent* GetTrackedComponent() const { return nullptr; }
+
+private:
 	bool Simulating = false;
+
+	/** 未模拟时设置的速度，StartSimulate 时交给 UFakePhysicsSubsystem */
+	FVector PendingVelocity = FVector::ZeroVector;
 };
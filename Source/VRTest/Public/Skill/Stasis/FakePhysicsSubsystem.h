@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Game/ProjectileSimulation.h"
+#include "FakePhysicsSubsystem.generated.h"
+
+class AFakePhysicsHandleActor;
+
+/**
+ * 弹簧追踪的批量积分（World 级子系统）
+ *
+ * - AFakePhysicsHandleActor（含 AStasisPoint）StartSimulate 时注册、StopSimulate/EndPlay 时注销，自身不再 Tick
+ * - 每帧一次：先从各 Actor 读取目标与弹簧参数，然后所有条目在紧凑数组上按同一固定步长积分，最后写回位置
+ * - 固定步长与箭飞行一致（FProjectileSimParams::FixedTimeStep），步数由本系统统一累积，所有条目同步推进
+ * - 写回的是最近两步之间按剩余累积时间插值的位置（每帧都写回），Actor 位置比模拟状态最多滞后一步
+ * - 压力测试：控制台 VRTest.FakePhysics.Stress <数量>（0 清除），条目数与耗时见 stat VRTest
+ */
+UCLASS()
+class VRTEST_API UFakePhysicsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的批量积分，非游戏世界返回 nullptr */
+	static UFakePhysicsSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	// ==================== 注册 ====================
+
+	/** 注册（已注册则重置状态）：从当前位置、零速度开始 */
+	void Register(AFakePhysicsHandleActor* Handle);
+
+	/** 注销；写回过程中（Overlap 回调里）调用时只清空条目，写回结束后再移除 */
+	void Unregister(const AFakePhysicsHandleActor* Handle);
+
+	/** 设置已注册条目的速度；未注册返回 false */
+	bool SetVelocity(const AFakePhysicsHandleActor* Handle, const FVector& Velocity);
+
+	/** 读取已注册条目的速度；未注册返回零向量 */
+	FVector GetVelocity(const AFakePhysicsHandleActor* Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "FakePhysicsHandle")
+	int32 GetHandleCount() const { return Handles.Num(); }
+
+	// ==================== 压力测试 ====================
+
+	/** 在 Center 周围生成 Count 个定身球追踪随机目标；Count <= 0 时清除之前生成的 */
+	void RunStressTest(int32 Count, const FVector& Center, float Radius);
+
+protected:
+	void RemoveAt(int32 Index);
+
+	// 紧凑数组（下标一致）
+	TArray<TWeakObjectPtr<AFakePhysicsHandleActor>> Handles;
+	TArray<FObjectKey> HandleKeys;
+	TArray<FProjectileSimState> States;
+	TArray<FProjectileSimParams> Params;
+
+	/** 上一次写回的位置：Actor 位置与之不同时视为被外部移动，模拟状态直接跳到新位置 */
+	TArray<FVector> RenderedLocations;
+
+	/** Actor -> 下标 */
+	TMap<FObjectKey, int32> IndexByHandle;
+
+	/** 所有条目共用的时间累积（不足一个固定步长的部分） */
+	float TimeAccumulator = 0.0f;
+
+	/** 正在写回位置：此时不移动数组元素，避免交换删除让写回循环跳过条目 */
+	bool bWritingBack = false;
+
+	/** 压力测试生成的 Actor */
+	TArray<TWeakObjectPtr<AActor>> StressActors;
+};
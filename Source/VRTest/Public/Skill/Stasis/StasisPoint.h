@@ -27,9 +27,11 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
-    virtual void Tick(float DeltaTime) override;
+    /** 追踪 Target（手或定身目标）：由 UFakePhysicsSubsystem 每帧读取，定身球自身不 Tick */
+    virtual const USceneComponent* GetTrackedComponent() const override;
 
     // Components
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -46,7 +48,7 @@ public:
     float TimeToStasis;
 
     /**
-     * 发射定身球：由定身球内部自行进行“SphereOverlap + 角度筛选 + IStasisable 筛选”，并决定追踪目标。
+     * 发射定身球：由定身球内部通过可定身物注册表（UStasisableRegistrySubsystem）做“距离 + 角度 + CanEnterStasis 筛选”，并决定追踪目标。
      * - PC：调用端传入 Origin=CameraLocation, AimDirection=CameraForward
      * - VR：调用端传入 Origin=HandLocation, AimDirection=LastVelocityDirection
      * - 若未找到目标：按 AimDirection 直飞到 MaxNoTargetDistance，并在 NoTargetLifeSeconds 后自毁
@@ -81,8 +83,8 @@ public:
     virtual void OnGrabbed_Implementation(UPlayerGrabHand* Hand) override;
     virtual void OnReleased_Implementation(UPlayerGrabHand* Hand) override;
     
-    virtual void OnGrabSelected_Implementation() override;
-    virtual void OnGrabDeselected_Implementation() override;
+    virtual void OnGrabSelected_Implementation(UPlayerGrabHand* Hand) override;
+    virtual void OnGrabDeselected_Implementation(UPlayerGrabHand* Hand) override;
 
 protected:
     // Event handlers
@@ -116,17 +118,6 @@ private:
     /** 选择要追踪的组件（仅用于“普通可定身物体”，不做尸体/复杂角色特殊处理） */
     static USceneComponent* ChooseTrackComponent(AActor* TargetActor);
 
-    /** 当前“无目标直飞”自毁定时器 */
-    FTimerHandle NoTargetDestroyTimerHandle;
-
-    /**
-     * 定身目标检测使用的 ObjectTypes（OverlapMultiByObjectType）。
-     * 默认包含：WorldDynamic / Pawn。
-     * 之所以放在定身球内部，是为了避免在 PC/VR 两侧重复配置。
-     */
-    UPROPERTY(EditDefaultsOnly, Category = "Stasis|Targeting")
-    TArray<TEnumAsByte<EObjectTypeQuery>> TargetingObjectTypes;
-
     /** 内部：根据发射上下文查找可定身目标（按角度优先） */
     AActor* FindStasisTarget(
         UObject* WorldContextObject,
@@ -30,6 +30,9 @@ public:
 
 	virtual bool Execute_Implementation(ABasePlayer* Player, const FSkillContext& Context) override;
 
+	/** 追加定身球类及其 Niagara 特效（特效由 SkillAsset 引用） */
+	virtual void GetPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const override;
+
 protected:
 	/** StasisPoint Actor 类（可在蓝图中配置） */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stasis")
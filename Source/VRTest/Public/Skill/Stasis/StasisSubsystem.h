@@ -0,0 +1,157 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Game/TimerWheel.h"
+#include "StasisSubsystem.generated.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 定身管理（World 级子系统）
+ *
+ * - 冻结：目标 Actor 的 CustomTimeDilation 置 0（动画/移动/Tick 全部停住），
+ *   正在模拟物理的 Primitive 记录速度后转为运动学（保留碰撞）；可一次冻结一批目标
+ * - 冻结期间受到的冲量不立即生效，按目标记录（冲量、作用点、骨骼、命中的 Primitive），
+ *   解除时连同原速度一起在原作用点施加到对应的物理体上（“蓄力”效果）
+ * - Actor 已失效的条目（包括不自动解除的）每帧清理
+ * - 所有到期（解除定身、定身球超时自毁）由一个时间轮驱动，不为每个目标/定身球创建 FTimerHandle；
+ *   同一帧到期的目标一起解除
+ *
+ * IStasisable 的实现在 EnterStasis/ExitStasis 中调用 Freeze/Release；到期时本系统先调用 ExitStasis，
+ * 实现方没有调用 Release 时再由本系统兜底解除。
+ */
+UCLASS()
+class VRTEST_API UStasisSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的定身管理，非游戏世界返回 nullptr */
+	static UStasisSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+	// ==================== 定身 ====================
+
+	/**
+	 * 冻结目标；已在定身中时只刷新时长
+	 * @param Duration 定身时长（秒），<= 0 表示不自动解除
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stasis")
+	bool Freeze(AActor* Target, float Duration);
+
+	/** 批量冻结，返回成功数量 */
+	int32 FreezeBatch(TConstArrayView<AActor*> Targets, float Duration);
+
+	/**
+	 * 解除定身：恢复时间膨胀与物理模拟
+	 * @param bApplyStoredMomentum 是否恢复冻结前的速度并施加冻结期间累计的冲量
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stasis")
+	bool Release(AActor* Target, bool bApplyStoredMomentum = true);
+
+	UFUNCTION(BlueprintPure, Category = "Stasis")
+	bool IsFrozen(const AActor* Target) const;
+
+	/** 给定身中的目标累加冲量（单位与 AddImpulse 相同，解除时作用在第一个模拟体的质心），目标不在定身中返回 false */
+	UFUNCTION(BlueprintCallable, Category = "Stasis")
+	bool AddStoredImpulse(AActor* Target, const FVector& Impulse);
+
+	/**
+	 * 给定身中的目标记录一个作用点冲量，解除时对命中的 Primitive/骨骼调用 AddImpulseAtLocation
+	 * @param HitComponent 命中的组件（其 Owner 必须在定身中）
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stasis")
+	bool AddStoredImpulseAtLocation(UPrimitiveComponent* HitComponent, const FVector& Impulse, const FVector& Location, FName BoneName = NAME_None);
+
+	UFUNCTION(BlueprintPure, Category = "Stasis")
+	int32 GetFrozenCount() const { return Entries.Num(); }
+
+	// ==================== 延迟销毁 ====================
+
+	/** Delay 秒后销毁 Actor（定身球无目标飞行超时等），重复调用以最后一次为准 */
+	void ScheduleDestroy(AActor* Actor, float Delay);
+
+	void CancelScheduledDestroy(const AActor* Actor);
+
+protected:
+	enum class ETimerTag : uint8
+	{
+		Release,
+		Destroy
+	};
+
+	struct FFrozenBody
+	{
+		TWeakObjectPtr<UPrimitiveComponent> Primitive;
+		FVector LinearVelocity = FVector::ZeroVector;
+		FVector AngularVelocityDeg = FVector::ZeroVector;
+	};
+
+	/** 冻结期间记录的冲量 */
+	struct FStoredImpulse
+	{
+		/** 命中的 Primitive（为空时作用在第一个模拟体上） */
+		TWeakObjectPtr<UPrimitiveComponent> Primitive;
+		FName BoneName;
+		FVector Impulse = FVector::ZeroVector;
+		FVector Location = FVector::ZeroVector;
+
+		/** 为 false 时作用在质心（AddImpulse） */
+		bool bAtLocation = false;
+	};
+
+	struct FStasisEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FObjectKey Key;
+
+		/** 冻结前在模拟物理的 Primitive（一般只有一个） */
+		TArray<FFrozenBody, TInlineAllocator<1>> Bodies;
+
+		float PrevTimeDilation = 1.0f;
+
+		/** 当前有效的解除定时（0 表示不自动解除） */
+		uint32 TimerId = 0;
+	};
+
+	/** 冻结目标（不查重） */
+	void FreezeNew(AActor* Target, float Duration);
+
+	/** 解除并移除条目（与末尾交换） */
+	void ReleaseAt(int32 Index, bool bApplyStoredMomentum);
+
+	/** 处理时间轮到期的定时 */
+	void ProcessExpired();
+
+	/** 记录一个冲量（同一物理体、同一作用方式的冲量超过上限后合并） */
+	void StoreImpulse(int32 Index, const FStoredImpulse& Impulse);
+
+	/** 移除 Actor 已失效的条目 */
+	void PruneStaleEntries();
+
+	// 紧凑数组（下标一致）
+	TArray<FStasisEntry> Entries;
+	TArray<TArray<FStoredImpulse, TInlineAllocator<2>>> StoredImpulses;
+
+	/** Actor -> 下标 */
+	TMap<FObjectKey, int32> IndexByActor;
+
+	/** 延迟销毁：Actor -> 当前有效的定时编号 */
+	TMap<FObjectKey, uint32> PendingDestroys;
+
+	FTimerWheel TimerWheel;
+
+	/** 本帧到期的定时（复用，避免每帧分配） */
+	TArray<FTimerWheelEntry> ExpiredTimers;
+};
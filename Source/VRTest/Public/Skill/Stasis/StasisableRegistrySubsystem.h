@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Game/ActorSpatialIndex.h"
+#include "StasisableRegistrySubsystem.generated.h"
+
+/**
+ * 可定身物注册表（World 级子系统）
+ *
+ * - 实现 IStasisable 的 Actor 在 BeginPlay 注册、EndPlay 注销（纯蓝图实现可调用 Register/Unregister）
+ * - 位置/包围半径取自根 Primitive 的 Bounds，存放在 FActorSpatialIndex 的紧凑数组与松散网格中
+ * - 锥形查询：FShapeQuery 批量判定（包围球 + 点积阈值，不做 Acos），候选按需堆选，
+ *   只对排在前面的候选调用 CanEnterStasis；耗时与场景物理复杂度无关
+ */
+UCLASS()
+class VRTEST_API UStasisableRegistrySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** 获取当前世界的注册表，非游戏世界返回 nullptr */
+	static UStasisableRegistrySubsystem* Get(const UObject* WorldContextObject);
+
+	/** 注册/注销可定身物（BeginPlay/EndPlay 调用的便捷入口） */
+	static void RegisterStasisable(AActor* Actor);
+	static void UnregisterStasisable(AActor* Actor);
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	// ==================== 注册 ====================
+
+	/** 注册可定身物（需实现 IStasisable） */
+	UFUNCTION(BlueprintCallable, Category = "Stasis|Registry")
+	void Register(AActor* Actor);
+
+	UFUNCTION(BlueprintCallable, Category = "Stasis|Registry")
+	void Unregister(AActor* Actor);
+
+	UFUNCTION(BlueprintPure, Category = "Stasis|Registry")
+	int32 GetRegisteredCount() const { return Index.Num(); }
+
+	/** 刷新后的空间索引（供 FShapeQuery 等通用查询使用） */
+	const FActorSpatialIndex& GetSpatialIndex();
+
+	// ==================== 查询 ====================
+
+	/**
+	 * 查找锥形内夹角最小、且 CanEnterStasis 的目标
+	 * @param Radius 检测距离（与目标包围球相交即可）
+	 * @param MaxAngleDegrees 锥形半角（度，可大于 90）
+	 * @return 没有符合条件的目标时返回 nullptr
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Stasis|Registry")
+	AActor* FindBestTarget(const FVector& Origin, const FVector& Direction, float Radius, float MaxAngleDegrees,
+		const TArray<AActor*>& IgnoreActors);
+
+protected:
+	/** 刷新空间索引（每帧最多一次） */
+	void RefreshIndex();
+
+	FActorSpatialIndex Index;
+
+	uint64 LastRefreshFrame = MAX_uint64;
+};
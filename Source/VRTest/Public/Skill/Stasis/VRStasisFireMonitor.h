@@ -14,9 +14,11 @@ class USceneComponent;
  * VR 定身球发射监视器
  * 
  * 职责：
- * - 监测 VR 手部速度
+ * - 监测 VR 手部速度（读取手部运动历史，不自行 Tick）
  * - 当速度超过阈值后开始下降时，自动触发定身球发射
  * - 发射后解锁手部并自毁
+ *
+ * 在手部每次记录运动采样后（OnHandMotionSampled）检查一次速度峰值。
  */
 UCLASS()
 class VRTEST_API AVRStasisFireMonitor : public AActor
@@ -28,10 +30,9 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
-	virtual void Tick(float DeltaTime) override;
-
 	/**
 	 * 初始化监视器
 	 * @param InHand 要监视的手部
@@ -51,6 +52,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stasis")
 	float FireSpeedFactor = 1.5f;
 
+	/** 速度回落到峰值的该比例以下时视为峰值已过，触发发射 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stasis", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float PeakSpeedDropRatio = 0.95f;
+
 	/** 定身球目标检测���径 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Stasis")
 	float DetectionRadius = 500.0f;
@@ -69,30 +74,20 @@ protected:
 	UPROPERTY()
 	AStasisPoint* StasisPoint = nullptr;
 
-	/** 上一帧手部位置 */
-	FVector LastHandLocation;
-
-	/** 当前手部速度 */
-	FVector CurrentVelocity;
-
-	/** 上一帧手部速度 */
-	FVector LastVelocity;
+	/** 开始监视的时间（只检测此后的速度峰值） */
+	double MonitorStartTime = 0.0;
 
-	/** 当前速度大小 */
-	float CurrentSpeed = 0.0f;
-
-	/** 上一帧速度大小 */
-	float LastSpeed = 0.0f;
-
-	/** 速度是否已超过阈值 */
-	bool bSpeedOverThreshold = false;
+	FDelegateHandle MotionSampledHandle;
 
 	// ==================== 内部函数 ====================
 	
-	/** 更新手部速度 */
-	void UpdateHandVelocity(float DeltaTime);
+	/** 手部记录运动采样后的回调：检测速度峰值 */
+	void HandleHandMotionSampled(UPlayerGrabHand* Hand);
+
+	/** 停止监听手部采样 */
+	void StopMonitoring();
 
 	/** 触发发射 */
-	void FireStasisPoint();
+	void FireStasisPoint(const FVector& PeakVelocity);
 };
 